@@ -6,6 +6,7 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Support for font atlases built with ImFontAtlasFlags_SignedDistanceField.
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -14,6 +15,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2022-08-22: OpenGL: Added support for signed distance field font atlases (ImFontAtlasFlags_SignedDistanceField), enable ImGuiBackendFlags_RendererHasSdfFonts flag.
 //  2022-05-23: OpenGL: Reworking 2021-12-15 "Using buffer orphaning" so it only happens on Intel GPU, seems to cause problems otherwise. (#4468, #4825, #4832, #5127).
 //  2022-05-13: OpenGL: Fix state corruption on OpenGL ES 2.0 due to not preserving GL_ELEMENT_ARRAY_BUFFER_BINDING and vertex attribute states.
 //  2021-12-15: OpenGL: Using buffer orphaning + glBufferSubData(), seems to fix leaks with multi-viewports with some Intel HD drivers.
@@ -187,6 +189,8 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationTexIsSdf;
+    GLint           AttribLocationTexSdfMinV;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -195,6 +199,8 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            FontTextureIsSdf;        // Font texture holds distance fields (ImFontAtlasFlags_SignedDistanceField)
+    float           FontTextureSdfMinV;      // Only glyphs, from this V coordinate, hold distance fields (see ImFontAtlas::TexSdfGlyphsMinY)
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -279,6 +285,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfFonts;       // We can threshold the font texture when it holds distance fields.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to NULL if unsure.
@@ -390,6 +397,8 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
+    glUniform1i(bd->AttribLocationTexIsSdf, 0);
+    glUniform1f(bd->AttribLocationTexSdfMinV, bd->FontTextureSdfMinV);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
@@ -473,6 +482,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     glGenVertexArrays(1, &vertex_array_object);
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+    bool last_tex_is_sdf = false;
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
@@ -518,7 +528,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    last_tex_is_sdf = false;
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -534,7 +547,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
 
                 // Bind texture, Draw
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
+                const GLuint tex_id = (GLuint)(intptr_t)pcmd->GetTexID();
+                const bool tex_is_sdf = bd->FontTextureIsSdf && tex_id == bd->FontTexture;
+                if (tex_is_sdf != last_tex_is_sdf)
+                {
+                    glUniform1i(bd->AttribLocationTexIsSdf, tex_is_sdf ? 1 : 0);
+                    last_tex_is_sdf = tex_is_sdf;
+                }
+                glBindTexture(GL_TEXTURE_2D, tex_id);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
@@ -612,6 +632,8 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    bd->FontTextureIsSdf = (io.Fonts->Flags & ImFontAtlasFlags_SignedDistanceField) != 0;
+    bd->FontTextureSdfMinV = bd->FontTextureIsSdf ? (float)io.Fonts->TexSdfGlyphsMinY / (float)height : 0.0f;
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -628,6 +650,8 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         glDeleteTextures(1, &bd->FontTexture);
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
+        bd->FontTextureIsSdf = false;
+        bd->FontTextureSdfMinV = 0.0f;
     }
 }
 
@@ -748,42 +772,82 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool TexIsSdf;\n"
+        "uniform float TexSdfMinV;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture2D(Texture, Frag_UV.st);\n"
+        "    if (TexIsSdf)\n"
+        "    {\n"
+        "#ifdef GL_ES\n"
+        "        float w = 0.1;\n" // No fwidth() without GL_OES_standard_derivatives
+        "#else\n"
+        "        float w = fwidth(tex_color.a);\n"
+        "#endif\n"
+        "        if (Frag_UV.y >= TexSdfMinV)\n" // Glyphs only, not white pixel/mouse cursors/lines/custom rects
+        "            tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    gl_FragColor = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform bool TexIsSdf;\n"
+        "uniform float TexSdfMinV;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (TexIsSdf)\n"
+        "    {\n"
+        "        float w = fwidth(tex_color.a);\n"
+        "        if (Frag_UV.y >= TexSdfMinV)\n" // Glyphs only, not white pixel/mouse cursors/lines/custom rects
+        "            tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool TexIsSdf;\n"
+        "uniform float TexSdfMinV;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (TexIsSdf)\n"
+        "    {\n"
+        "        float w = fwidth(tex_color.a);\n"
+        "        if (Frag_UV.y >= TexSdfMinV)\n" // Glyphs only, not white pixel/mouse cursors/lines/custom rects
+        "            tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool TexIsSdf;\n"
+        "uniform float TexSdfMinV;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (TexIsSdf)\n"
+        "    {\n"
+        "        float w = fwidth(tex_color.a);\n"
+        "        if (Frag_UV.y >= TexSdfMinV)\n" // Glyphs only, not white pixel/mouse cursors/lines/custom rects
+        "            tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -837,6 +901,8 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationTexIsSdf = glGetUniformLocation(bd->ShaderHandle, "TexIsSdf");
+    bd->AttribLocationTexSdfMinV = glGetUniformLocation(bd->ShaderHandle, "TexSdfMinV");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
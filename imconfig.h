@@ -70,10 +70,22 @@
 // Compatibility checks of arguments and formats done by clang and GCC will be disabled in order to support the extra formats provided by stb_sprintf.h.
 //#define IMGUI_USE_STB_SPRINTF
 
+//---- Declare functions taking std::string_view (e.g. ImGui::Button(std::string_view)) in misc/cpp/imgui_stdlib.h. Requires C++17.
+//#define IMGUI_STDLIB_ENABLE_STRING_VIEW
+
+//---- Use a hash table for ImGuiStorage (window state storage, tree nodes open state, pools of tables/tab bars, etc.) instead of a sorted array.
+// Query and insertion are O(1) instead of O(log N) and O(N), at the cost of ~8 more bytes per pair. Recommended with large trees (e.g. 100k+ nodes).
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Use hardware CRC32C instructions (SSE4.2 or ARMv8) to hash IDs instead of the default software CRC32. Faster with long labels/ID stacks.
+// This changes all IDs: settings saved with IDs (e.g. tables in .ini files) won't be recognized by a build using the other hash.
+//#define IMGUI_USE_CRC32C_HASH
+
 //---- Use FreeType to build and rasterize the font atlas (instead of stb_truetype which is embedded by default in Dear ImGui)
 // Requires FreeType headers to be available in the include path. Requires program to be compiled with 'misc/freetype/imgui_freetype.cpp' (in this repository) + the FreeType library (not provided).
 // On Windows you may use vcpkg with 'vcpkg install freetype --triplet=x64-windows' + 'vcpkg integrate install'.
 //#define IMGUI_ENABLE_FREETYPE
+//#define IMGUI_ENABLE_FREETYPE_THREADS         // Render glyphs on multiple threads using std::thread (FreeType builder only)
 
 //---- Use stb_truetype to build and rasterize the font atlas (default)
 // The only purpose of this define is if you want force compilation of the stb_truetype backend ALONG with the FreeType backend.
@@ -116,6 +128,16 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Enable the built-in CPU profiler, timing NewFrame(), Begin()/End() of each window, tables layout, Render() etc. over the last frames.
+// Results are displayed in 'Metrics->Profiler' and can be saved as Chrome Trace Event JSON. When not defined, all profiler code and markers are compiled out.
+//#define IMGUI_ENABLE_PROFILER
+
+//---- Debug Tools: Enable memory tracking: current/peak bytes and per-frame allocations counts for each subsystem (draw lists, windows, tables, fonts, etc.)
+// Results are displayed in 'Metrics->Memory' and available from ImGui::GetAllocatorStats(). Adds a 16 bytes header to every allocation.
+// If your allocator returns blocks with a larger alignment (e.g. 32 or 64 bytes) and you rely on it, set the header size to that alignment.
+//#define IMGUI_ENABLE_MEMORY_TRACKING
+//#define IMGUI_MEM_TRACKING_HEADER_SIZE 64
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui
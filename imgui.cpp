@@ -61,11 +61,12 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
+// [SECTION] MISC HELPERS/UTILITIES (Time functions)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -82,6 +83,7 @@ CODE
 // [SECTION] SETTINGS
 // [SECTION] VIEWPORTS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, STACK TOOL)
@@ -842,6 +844,10 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#include <time.h>       // clock_gettime
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+#include <atomic>       // std::atomic
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -930,6 +936,8 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Extend outside window for hovering/resizing (maxxed with TouchPadding) and inside windows for borders. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
+static const int   WINDOWS_HOVER_GRID_MIN_COUNT             = 64;       // Minimum number of windows to use a uniform grid in FindHoveredWindow(), instead of testing every window.
+static const int   WINDOWS_HOVER_GRID_MAX_CELLS             = 64;       // Maximum number of cells along each axis of the grid used by FindHoveredWindow().
 
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
@@ -937,6 +945,7 @@ static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock
 
 static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
+static void             UpdateWindowsHoverGrid();
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
@@ -1044,6 +1053,20 @@ static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_d
 static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+// Allocation counters of one tag, updated atomically as allocations can be made from any thread. See GetAllocatorStats() for a snapshot.
+struct ImGuiMemTagAtomicStats
+{
+    std::atomic<size_t>     BytesCurrent;
+    std::atomic<size_t>     BytesPeak;
+    std::atomic<int>        AllocsCurrent;
+    std::atomic<int>        AllocsTotal;
+    std::atomic<int>        AllocsThisFrame;
+    std::atomic<int>        AllocsLastFrame;
+};
+static thread_local ImGuiMemTag     GImAllocatorTag = ImGuiMemTag_Other;            // Per thread: a tag scope on one thread doesn't affect other threads
+static ImGuiMemTagAtomicStats       GImAllocatorStats[ImGuiMemTag_COUNT + 1];       // Last one is the total of all tags
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
@@ -1169,6 +1192,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigTextSizeCache = false;
+    ConfigWrappedTextLayoutCache = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1684,7 +1709,175 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
-int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
+// Fast path for the most common formats, e.g. "%d", "%.3f", "Value: %u" or no conversion at all, bypassing vsnprintf().
+// - Supported: literal text + a single "%d", "%i", "%u", "%lld", "%llu", "%I64d", "%I64u", "%f", "%.Nf", "%g" or "%.Ng" (no flags, no width) + literal text.
+// - Output is identical to vsnprintf(). Floating-point values are rounded in double precision: when the result can't be guaranteed
+//   to be correctly rounded (large values, values too close to halfway between two outputs, infinities, NaN), vsnprintf() is used.
+struct ImFormatFastSpec
+{
+    const char*     ConvBegin;      // Position of '%', or end of format when there's no conversion
+    const char*     ConvEnd;
+    char            Type;           // 0: no conversion, 'd': int, 'u': unsigned int, 'D': 64-bit int, 'U': 64-bit unsigned int, 'f', 'g': double
+    int             Precision;
+};
+
+static bool ImFormatParseFastSpec(const char* fmt, ImFormatFastSpec* spec)
+{
+    const char* p = fmt;
+    while (*p && *p != '%')
+        p++;
+    spec->ConvBegin = spec->ConvEnd = p;
+    spec->Type = 0;
+    spec->Precision = -1;
+    if (*p == 0)
+        return true;
+    p++;
+    if (*p == '.')
+    {
+        p++;
+        spec->Precision = 0;
+        for (int n = 0; n < 2 && *p >= '0' && *p <= '9'; n++)
+            spec->Precision = spec->Precision * 10 + (*p++ - '0');
+        if (*p != 'f' && *p != 'g')
+            return false;
+    }
+    if (*p == 'd' || *p == 'i')                             { spec->Type = 'd'; p += 1; }
+    else if (*p == 'u')                                     { spec->Type = 'u'; p += 1; }
+    else if (*p == 'f' || *p == 'g')                        { spec->Type = *p; p += 1; }
+    else if (p[0] == 'l' && p[1] == 'l' && (p[2] == 'd' || p[2] == 'u'))                    { spec->Type = (p[2] == 'd') ? 'D' : 'U'; p += 3; }
+    else if (p[0] == 'I' && p[1] == '6' && p[2] == '4' && (p[3] == 'd' || p[3] == 'u'))     { spec->Type = (p[3] == 'd') ? 'D' : 'U'; p += 4; }
+    else
+        return false;
+    spec->ConvEnd = p;
+    while (*p)
+        if (*p++ == '%')
+            return false;
+    return true;
+}
+
+// Write digits of an unsigned integer, backward from 'p_end'
+static char* ImFormatWriteU64Backward(char* p_end, ImU64 v)
+{
+    do { *--p_end = (char)('0' + (int)(v % 10)); v /= 10; } while (v != 0);
+    return p_end;
+}
+
+static const double GPow10Double[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 }; // All exactly representable
+
+// Round 'v * 10^decimals' to an integer, only succeeding if the result is guaranteed to be the correctly rounded one.
+// fl(v * 10^decimals) is within half an ulp of the exact product, so unless its fractional part is within an ulp of 0.5, rounding it gives the same
+// integer as rounding the exact product. Exact and near ties are left to vsnprintf(), which rounds them to even using the exact binary value.
+static bool ImFormatRoundScaled(double v, int decimals, ImU64* out_r)
+{
+    if (decimals < 0 || decimals >= IM_ARRAYSIZE(GPow10Double))
+        return false;
+    const double scaled = v * GPow10Double[decimals];
+    if (!(scaled < 4503599627370496.0)) // 2^52, also rejects NaN
+        return false;
+    const double scaled_floor = (double)(ImU64)scaled;
+    const double frac = scaled - scaled_floor;
+    if (fabs(frac - 0.5) <= scaled * 4.5e-16 + 1e-300)
+        return false;
+    *out_r = (ImU64)scaled_floor + (frac > 0.5 ? 1 : 0);
+    return true;
+}
+
+// Write 'r / 10^decimals' with 'decimals' digits after the decimal point, backward from 'p_end'
+static char* ImFormatWriteFixedBackward(char* p_end, ImU64 r, int decimals)
+{
+    char* p = p_end;
+    for (int n = 0; n < decimals; n++, r /= 10)
+        *--p = (char)('0' + (int)(r % 10));
+    if (decimals > 0)
+        *--p = '.';
+    return ImFormatWriteU64Backward(p, r);
+}
+
+// Format a double for "%.Nf" or "%.Ng" (general == true), backward from 'out_end'. Return NULL if it can't be formatted exactly.
+static char* ImFormatDoubleFast(char* out_end, double v, int precision, bool general)
+{
+    ImU64 v_bits;
+    memcpy(&v_bits, &v, sizeof(v));
+    const bool negative = (v_bits >> 63) != 0; // Sign bit: -0.0 and small negative values are printed as "-0.000" or "-0"
+    const double a = negative ? -v : v;
+    char* p;
+    if (!general)
+    {
+        ImU64 r;
+        if (!ImFormatRoundScaled(a, precision, &r))
+            return NULL;
+        p = ImFormatWriteFixedBackward(out_end, r, precision);
+    }
+    else
+    {
+        // "%g": style "%f" with P significant digits when the exponent X of the value rounded to P digits is -4 <= X < P, then trailing zeros are removed.
+        // Other values use style "%e", left to vsnprintf().
+        if (precision == 0)
+            precision = 1;
+        if (precision > 15)
+            return NULL;
+        if (a == 0.0)
+        {
+            p = out_end - 1;
+            *p = '0';
+        }
+        else
+        {
+            if (!(a >= 0.9e-5 && a < 1e15))
+                return NULL;
+
+            // Exponent of the value before rounding. Powers of ten below 1 aren't representable, so compare a * 10^k with 1 instead (rounding
+            // of the product is monotonic: only a product of exactly 1.0 is ambiguous).
+            int exponent = -5;
+            for (; exponent < 14; exponent++)
+            {
+                if (exponent + 1 >= 0)
+                {
+                    if (a < GPow10Double[exponent + 1])
+                        break;
+                }
+                else
+                {
+                    const double m = a * GPow10Double[-(exponent + 1)];
+                    if (m == 1.0)
+                        return NULL;
+                    if (m < 1.0)
+                        break;
+                }
+            }
+            if (exponent >= precision)
+                return NULL;
+
+            // Round to 'precision' significant digits, which may increase the exponent (e.g. 9.9999996 -> "10")
+            ImU64 r;
+            if (!ImFormatRoundScaled(a, precision - 1 - exponent, &r))
+                return NULL;
+            if ((double)r >= GPow10Double[precision])
+            {
+                r /= 10;
+                exponent++;
+            }
+            else if ((double)r < GPow10Double[precision - 1]) // Value below 1e-5
+            {
+                return NULL;
+            }
+            if (exponent < -4 || exponent >= precision)
+                return NULL;
+            int decimals = precision - 1 - exponent;
+            while (decimals > 0 && (r % 10) == 0)
+            {
+                r /= 10;
+                decimals--;
+            }
+            p = ImFormatWriteFixedBackward(out_end, r, decimals);
+        }
+    }
+    if (negative)
+        *--p = '-';
+    return p;
+}
+
+static int ImFormatStringSlow(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
@@ -1694,20 +1887,65 @@ int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
     int w = vsnprintf(buf, buf_size, fmt, args);
 #endif
     va_end(args);
-    if (buf == NULL)
-        return w;
-    if (w == -1 || w >= (int)buf_size)
-        w = (int)buf_size - 1;
-    buf[w] = 0;
+    return w;
+}
+
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, const ImFormatFastSpec& spec, va_list args)
+{
+    char value_buf[64];
+    char* value_end = value_buf + IM_ARRAYSIZE(value_buf);
+    char* value = value_end;
+    switch (spec.Type)
+    {
+    case 0:   break;
+    case 'd': { int v = va_arg(args, int); value = ImFormatWriteU64Backward(value_end, v < 0 ? (ImU64)0 - (ImU64)(ImS64)v : (ImU64)v); if (v < 0) *--value = '-'; break; }
+    case 'u': { value = ImFormatWriteU64Backward(value_end, va_arg(args, unsigned int)); break; }
+    case 'D': { ImS64 v = va_arg(args, ImS64); value = ImFormatWriteU64Backward(value_end, v < 0 ? (ImU64)0 - (ImU64)v : (ImU64)v); if (v < 0) *--value = '-'; break; }
+    case 'U': { value = ImFormatWriteU64Backward(value_end, va_arg(args, ImU64)); break; }
+    case 'f':
+    case 'g':
+    {
+        const double v = va_arg(args, double);
+        value = ImFormatDoubleFast(value_end, v, spec.Precision >= 0 ? spec.Precision : 6, spec.Type == 'g');
+        if (value == NULL)
+            return ImFormatStringSlow(buf, buf_size, fmt, v); // Exactly one conversion: forward the value we consumed
+        break;
+    }
+    }
+
+    // Concatenate literal text and value, truncating like vsnprintf() (return value is adjusted by the caller)
+    const char* parts[3][2] = { { fmt, spec.ConvBegin }, { value, value_end }, { spec.ConvEnd, spec.ConvEnd + strlen(spec.ConvEnd) } };
+    size_t total = 0;
+    for (int part_n = 0; part_n < 3; part_n++)
+    {
+        const size_t part_len = (size_t)(parts[part_n][1] - parts[part_n][0]);
+        if (total + 1 < buf_size)
+            memcpy(buf + total, parts[part_n][0], ImMin(part_len, buf_size - 1 - total));
+        total += part_len;
+    }
+    return (int)total;
+}
+
+int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int w = ImFormatStringV(buf, buf_size, fmt, args);
+    va_end(args);
     return w;
 }
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
+    int w;
+    ImFormatFastSpec spec;
+    if (buf != NULL && buf_size > 0 && ImFormatParseFastSpec(fmt, &spec))
+        w = ImFormatStringFastV(buf, buf_size, fmt, spec, args);
+    else
 #ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
+        w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
-    int w = vsnprintf(buf, buf_size, fmt, args);
+        w = vsnprintf(buf, buf_size, fmt, args);
 #endif
     if (buf == NULL)
         return w;
@@ -1760,48 +1998,275 @@ static const ImU32 GCrc32LookupTable[256] =
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
 
+// Slicing-by-8: GCrc32SliceBy8LookupTable[N - 1][n] is the CRC32 of byte 'n' followed by N zero bytes.
+// This allows processing 8 bytes per iteration with independent lookups instead of a chain of dependent ones, with identical output.
+static const ImU32 GCrc32SliceBy8LookupTable[7][256] =
+{
+    {
+        0x00000000,0x191B3141,0x32366282,0x2B2D53C3,0x646CC504,0x7D77F445,0x565AA786,0x4F4196C7,0xC8D98A08,0xD1C2BB49,0xFAEFE88A,0xE3F4D9CB,0xACB54F0C,0xB5AE7E4D,0x9E832D8E,0x87981CCF,
+        0x4AC21251,0x53D92310,0x78F470D3,0x61EF4192,0x2EAED755,0x37B5E614,0x1C98B5D7,0x05838496,0x821B9859,0x9B00A918,0xB02DFADB,0xA936CB9A,0xE6775D5D,0xFF6C6C1C,0xD4413FDF,0xCD5A0E9E,
+        0x958424A2,0x8C9F15E3,0xA7B24620,0xBEA97761,0xF1E8E1A6,0xE8F3D0E7,0xC3DE8324,0xDAC5B265,0x5D5DAEAA,0x44469FEB,0x6F6BCC28,0x7670FD69,0x39316BAE,0x202A5AEF,0x0B07092C,0x121C386D,
+        0xDF4636F3,0xC65D07B2,0xED705471,0xF46B6530,0xBB2AF3F7,0xA231C2B6,0x891C9175,0x9007A034,0x179FBCFB,0x0E848DBA,0x25A9DE79,0x3CB2EF38,0x73F379FF,0x6AE848BE,0x41C51B7D,0x58DE2A3C,
+        0xF0794F05,0xE9627E44,0xC24F2D87,0xDB541CC6,0x94158A01,0x8D0EBB40,0xA623E883,0xBF38D9C2,0x38A0C50D,0x21BBF44C,0x0A96A78F,0x138D96CE,0x5CCC0009,0x45D73148,0x6EFA628B,0x77E153CA,
+        0xBABB5D54,0xA3A06C15,0x888D3FD6,0x91960E97,0xDED79850,0xC7CCA911,0xECE1FAD2,0xF5FACB93,0x7262D75C,0x6B79E61D,0x4054B5DE,0x594F849F,0x160E1258,0x0F152319,0x243870DA,0x3D23419B,
+        0x65FD6BA7,0x7CE65AE6,0x57CB0925,0x4ED03864,0x0191AEA3,0x188A9FE2,0x33A7CC21,0x2ABCFD60,0xAD24E1AF,0xB43FD0EE,0x9F12832D,0x8609B26C,0xC94824AB,0xD05315EA,0xFB7E4629,0xE2657768,
+        0x2F3F79F6,0x362448B7,0x1D091B74,0x04122A35,0x4B53BCF2,0x52488DB3,0x7965DE70,0x607EEF31,0xE7E6F3FE,0xFEFDC2BF,0xD5D0917C,0xCCCBA03D,0x838A36FA,0x9A9107BB,0xB1BC5478,0xA8A76539,
+        0x3B83984B,0x2298A90A,0x09B5FAC9,0x10AECB88,0x5FEF5D4F,0x46F46C0E,0x6DD93FCD,0x74C20E8C,0xF35A1243,0xEA412302,0xC16C70C1,0xD8774180,0x9736D747,0x8E2DE606,0xA500B5C5,0xBC1B8484,
+        0x71418A1A,0x685ABB5B,0x4377E898,0x5A6CD9D9,0x152D4F1E,0x0C367E5F,0x271B2D9C,0x3E001CDD,0xB9980012,0xA0833153,0x8BAE6290,0x92B553D1,0xDDF4C516,0xC4EFF457,0xEFC2A794,0xF6D996D5,
+        0xAE07BCE9,0xB71C8DA8,0x9C31DE6B,0x852AEF2A,0xCA6B79ED,0xD37048AC,0xF85D1B6F,0xE1462A2E,0x66DE36E1,0x7FC507A0,0x54E85463,0x4DF36522,0x02B2F3E5,0x1BA9C2A4,0x30849167,0x299FA026,
+        0xE4C5AEB8,0xFDDE9FF9,0xD6F3CC3A,0xCFE8FD7B,0x80A96BBC,0x99B25AFD,0xB29F093E,0xAB84387F,0x2C1C24B0,0x350715F1,0x1E2A4632,0x07317773,0x4870E1B4,0x516BD0F5,0x7A468336,0x635DB277,
+        0xCBFAD74E,0xD2E1E60F,0xF9CCB5CC,0xE0D7848D,0xAF96124A,0xB68D230B,0x9DA070C8,0x84BB4189,0x03235D46,0x1A386C07,0x31153FC4,0x280E0E85,0x674F9842,0x7E54A903,0x5579FAC0,0x4C62CB81,
+        0x8138C51F,0x9823F45E,0xB30EA79D,0xAA1596DC,0xE554001B,0xFC4F315A,0xD7626299,0xCE7953D8,0x49E14F17,0x50FA7E56,0x7BD72D95,0x62CC1CD4,0x2D8D8A13,0x3496BB52,0x1FBBE891,0x06A0D9D0,
+        0x5E7EF3EC,0x4765C2AD,0x6C48916E,0x7553A02F,0x3A1236E8,0x230907A9,0x0824546A,0x113F652B,0x96A779E4,0x8FBC48A5,0xA4911B66,0xBD8A2A27,0xF2CBBCE0,0xEBD08DA1,0xC0FDDE62,0xD9E6EF23,
+        0x14BCE1BD,0x0DA7D0FC,0x268A833F,0x3F91B27E,0x70D024B9,0x69CB15F8,0x42E6463B,0x5BFD777A,0xDC656BB5,0xC57E5AF4,0xEE530937,0xF7483876,0xB809AEB1,0xA1129FF0,0x8A3FCC33,0x9324FD72,
+    },
+    {
+        0x00000000,0x01C26A37,0x0384D46E,0x0246BE59,0x0709A8DC,0x06CBC2EB,0x048D7CB2,0x054F1685,0x0E1351B8,0x0FD13B8F,0x0D9785D6,0x0C55EFE1,0x091AF964,0x08D89353,0x0A9E2D0A,0x0B5C473D,
+        0x1C26A370,0x1DE4C947,0x1FA2771E,0x1E601D29,0x1B2F0BAC,0x1AED619B,0x18ABDFC2,0x1969B5F5,0x1235F2C8,0x13F798FF,0x11B126A6,0x10734C91,0x153C5A14,0x14FE3023,0x16B88E7A,0x177AE44D,
+        0x384D46E0,0x398F2CD7,0x3BC9928E,0x3A0BF8B9,0x3F44EE3C,0x3E86840B,0x3CC03A52,0x3D025065,0x365E1758,0x379C7D6F,0x35DAC336,0x3418A901,0x3157BF84,0x3095D5B3,0x32D36BEA,0x331101DD,
+        0x246BE590,0x25A98FA7,0x27EF31FE,0x262D5BC9,0x23624D4C,0x22A0277B,0x20E69922,0x2124F315,0x2A78B428,0x2BBADE1F,0x29FC6046,0x283E0A71,0x2D711CF4,0x2CB376C3,0x2EF5C89A,0x2F37A2AD,
+        0x709A8DC0,0x7158E7F7,0x731E59AE,0x72DC3399,0x7793251C,0x76514F2B,0x7417F172,0x75D59B45,0x7E89DC78,0x7F4BB64F,0x7D0D0816,0x7CCF6221,0x798074A4,0x78421E93,0x7A04A0CA,0x7BC6CAFD,
+        0x6CBC2EB0,0x6D7E4487,0x6F38FADE,0x6EFA90E9,0x6BB5866C,0x6A77EC5B,0x68315202,0x69F33835,0x62AF7F08,0x636D153F,0x612BAB66,0x60E9C151,0x65A6D7D4,0x6464BDE3,0x662203BA,0x67E0698D,
+        0x48D7CB20,0x4915A117,0x4B531F4E,0x4A917579,0x4FDE63FC,0x4E1C09CB,0x4C5AB792,0x4D98DDA5,0x46C49A98,0x4706F0AF,0x45404EF6,0x448224C1,0x41CD3244,0x400F5873,0x4249E62A,0x438B8C1D,
+        0x54F16850,0x55330267,0x5775BC3E,0x56B7D609,0x53F8C08C,0x523AAABB,0x507C14E2,0x51BE7ED5,0x5AE239E8,0x5B2053DF,0x5966ED86,0x58A487B1,0x5DEB9134,0x5C29FB03,0x5E6F455A,0x5FAD2F6D,
+        0xE1351B80,0xE0F771B7,0xE2B1CFEE,0xE373A5D9,0xE63CB35C,0xE7FED96B,0xE5B86732,0xE47A0D05,0xEF264A38,0xEEE4200F,0xECA29E56,0xED60F461,0xE82FE2E4,0xE9ED88D3,0xEBAB368A,0xEA695CBD,
+        0xFD13B8F0,0xFCD1D2C7,0xFE976C9E,0xFF5506A9,0xFA1A102C,0xFBD87A1B,0xF99EC442,0xF85CAE75,0xF300E948,0xF2C2837F,0xF0843D26,0xF1465711,0xF4094194,0xF5CB2BA3,0xF78D95FA,0xF64FFFCD,
+        0xD9785D60,0xD8BA3757,0xDAFC890E,0xDB3EE339,0xDE71F5BC,0xDFB39F8B,0xDDF521D2,0xDC374BE5,0xD76B0CD8,0xD6A966EF,0xD4EFD8B6,0xD52DB281,0xD062A404,0xD1A0CE33,0xD3E6706A,0xD2241A5D,
+        0xC55EFE10,0xC49C9427,0xC6DA2A7E,0xC7184049,0xC25756CC,0xC3953CFB,0xC1D382A2,0xC011E895,0xCB4DAFA8,0xCA8FC59F,0xC8C97BC6,0xC90B11F1,0xCC440774,0xCD866D43,0xCFC0D31A,0xCE02B92D,
+        0x91AF9640,0x906DFC77,0x922B422E,0x93E92819,0x96A63E9C,0x976454AB,0x9522EAF2,0x94E080C5,0x9FBCC7F8,0x9E7EADCF,0x9C381396,0x9DFA79A1,0x98B56F24,0x99770513,0x9B31BB4A,0x9AF3D17D,
+        0x8D893530,0x8C4B5F07,0x8E0DE15E,0x8FCF8B69,0x8A809DEC,0x8B42F7DB,0x89044982,0x88C623B5,0x839A6488,0x82580EBF,0x801EB0E6,0x81DCDAD1,0x8493CC54,0x8551A663,0x8717183A,0x86D5720D,
+        0xA9E2D0A0,0xA820BA97,0xAA6604CE,0xABA46EF9,0xAEEB787C,0xAF29124B,0xAD6FAC12,0xACADC625,0xA7F18118,0xA633EB2F,0xA4755576,0xA5B73F41,0xA0F829C4,0xA13A43F3,0xA37CFDAA,0xA2BE979D,
+        0xB5C473D0,0xB40619E7,0xB640A7BE,0xB782CD89,0xB2CDDB0C,0xB30FB13B,0xB1490F62,0xB08B6555,0xBBD72268,0xBA15485F,0xB853F606,0xB9919C31,0xBCDE8AB4,0xBD1CE083,0xBF5A5EDA,0xBE9834ED,
+    },
+    {
+        0x00000000,0xB8BC6765,0xAA09C88B,0x12B5AFEE,0x8F629757,0x37DEF032,0x256B5FDC,0x9DD738B9,0xC5B428EF,0x7D084F8A,0x6FBDE064,0xD7018701,0x4AD6BFB8,0xF26AD8DD,0xE0DF7733,0x58631056,
+        0x5019579F,0xE8A530FA,0xFA109F14,0x42ACF871,0xDF7BC0C8,0x67C7A7AD,0x75720843,0xCDCE6F26,0x95AD7F70,0x2D111815,0x3FA4B7FB,0x8718D09E,0x1ACFE827,0xA2738F42,0xB0C620AC,0x087A47C9,
+        0xA032AF3E,0x188EC85B,0x0A3B67B5,0xB28700D0,0x2F503869,0x97EC5F0C,0x8559F0E2,0x3DE59787,0x658687D1,0xDD3AE0B4,0xCF8F4F5A,0x7733283F,0xEAE41086,0x525877E3,0x40EDD80D,0xF851BF68,
+        0xF02BF8A1,0x48979FC4,0x5A22302A,0xE29E574F,0x7F496FF6,0xC7F50893,0xD540A77D,0x6DFCC018,0x359FD04E,0x8D23B72B,0x9F9618C5,0x272A7FA0,0xBAFD4719,0x0241207C,0x10F48F92,0xA848E8F7,
+        0x9B14583D,0x23A83F58,0x311D90B6,0x89A1F7D3,0x1476CF6A,0xACCAA80F,0xBE7F07E1,0x06C36084,0x5EA070D2,0xE61C17B7,0xF4A9B859,0x4C15DF3C,0xD1C2E785,0x697E80E0,0x7BCB2F0E,0xC377486B,
+        0xCB0D0FA2,0x73B168C7,0x6104C729,0xD9B8A04C,0x446F98F5,0xFCD3FF90,0xEE66507E,0x56DA371B,0x0EB9274D,0xB6054028,0xA4B0EFC6,0x1C0C88A3,0x81DBB01A,0x3967D77F,0x2BD27891,0x936E1FF4,
+        0x3B26F703,0x839A9066,0x912F3F88,0x299358ED,0xB4446054,0x0CF80731,0x1E4DA8DF,0xA6F1CFBA,0xFE92DFEC,0x462EB889,0x549B1767,0xEC277002,0x71F048BB,0xC94C2FDE,0xDBF98030,0x6345E755,
+        0x6B3FA09C,0xD383C7F9,0xC1366817,0x798A0F72,0xE45D37CB,0x5CE150AE,0x4E54FF40,0xF6E89825,0xAE8B8873,0x1637EF16,0x048240F8,0xBC3E279D,0x21E91F24,0x99557841,0x8BE0D7AF,0x335CB0CA,
+        0xED59B63B,0x55E5D15E,0x47507EB0,0xFFEC19D5,0x623B216C,0xDA874609,0xC832E9E7,0x708E8E82,0x28ED9ED4,0x9051F9B1,0x82E4565F,0x3A58313A,0xA78F0983,0x1F336EE6,0x0D86C108,0xB53AA66D,
+        0xBD40E1A4,0x05FC86C1,0x1749292F,0xAFF54E4A,0x322276F3,0x8A9E1196,0x982BBE78,0x2097D91D,0x78F4C94B,0xC048AE2E,0xD2FD01C0,0x6A4166A5,0xF7965E1C,0x4F2A3979,0x5D9F9697,0xE523F1F2,
+        0x4D6B1905,0xF5D77E60,0xE762D18E,0x5FDEB6EB,0xC2098E52,0x7AB5E937,0x680046D9,0xD0BC21BC,0x88DF31EA,0x3063568F,0x22D6F961,0x9A6A9E04,0x07BDA6BD,0xBF01C1D8,0xADB46E36,0x15080953,
+        0x1D724E9A,0xA5CE29FF,0xB77B8611,0x0FC7E174,0x9210D9CD,0x2AACBEA8,0x38191146,0x80A57623,0xD8C66675,0x607A0110,0x72CFAEFE,0xCA73C99B,0x57A4F122,0xEF189647,0xFDAD39A9,0x45115ECC,
+        0x764DEE06,0xCEF18963,0xDC44268D,0x64F841E8,0xF92F7951,0x41931E34,0x5326B1DA,0xEB9AD6BF,0xB3F9C6E9,0x0B45A18C,0x19F00E62,0xA14C6907,0x3C9B51BE,0x842736DB,0x96929935,0x2E2EFE50,
+        0x2654B999,0x9EE8DEFC,0x8C5D7112,0x34E11677,0xA9362ECE,0x118A49AB,0x033FE645,0xBB838120,0xE3E09176,0x5B5CF613,0x49E959FD,0xF1553E98,0x6C820621,0xD43E6144,0xC68BCEAA,0x7E37A9CF,
+        0xD67F4138,0x6EC3265D,0x7C7689B3,0xC4CAEED6,0x591DD66F,0xE1A1B10A,0xF3141EE4,0x4BA87981,0x13CB69D7,0xAB770EB2,0xB9C2A15C,0x017EC639,0x9CA9FE80,0x241599E5,0x36A0360B,0x8E1C516E,
+        0x866616A7,0x3EDA71C2,0x2C6FDE2C,0x94D3B949,0x090481F0,0xB1B8E695,0xA30D497B,0x1BB12E1E,0x43D23E48,0xFB6E592D,0xE9DBF6C3,0x516791A6,0xCCB0A91F,0x740CCE7A,0x66B96194,0xDE0506F1,
+    },
+    {
+        0x00000000,0x3D6029B0,0x7AC05360,0x47A07AD0,0xF580A6C0,0xC8E08F70,0x8F40F5A0,0xB220DC10,0x30704BC1,0x0D106271,0x4AB018A1,0x77D03111,0xC5F0ED01,0xF890C4B1,0xBF30BE61,0x825097D1,
+        0x60E09782,0x5D80BE32,0x1A20C4E2,0x2740ED52,0x95603142,0xA80018F2,0xEFA06222,0xD2C04B92,0x5090DC43,0x6DF0F5F3,0x2A508F23,0x1730A693,0xA5107A83,0x98705333,0xDFD029E3,0xE2B00053,
+        0xC1C12F04,0xFCA106B4,0xBB017C64,0x866155D4,0x344189C4,0x0921A074,0x4E81DAA4,0x73E1F314,0xF1B164C5,0xCCD14D75,0x8B7137A5,0xB6111E15,0x0431C205,0x3951EBB5,0x7EF19165,0x4391B8D5,
+        0xA121B886,0x9C419136,0xDBE1EBE6,0xE681C256,0x54A11E46,0x69C137F6,0x2E614D26,0x13016496,0x9151F347,0xAC31DAF7,0xEB91A027,0xD6F18997,0x64D15587,0x59B17C37,0x1E1106E7,0x23712F57,
+        0x58F35849,0x659371F9,0x22330B29,0x1F532299,0xAD73FE89,0x9013D739,0xD7B3ADE9,0xEAD38459,0x68831388,0x55E33A38,0x124340E8,0x2F236958,0x9D03B548,0xA0639CF8,0xE7C3E628,0xDAA3CF98,
+        0x3813CFCB,0x0573E67B,0x42D39CAB,0x7FB3B51B,0xCD93690B,0xF0F340BB,0xB7533A6B,0x8A3313DB,0x0863840A,0x3503ADBA,0x72A3D76A,0x4FC3FEDA,0xFDE322CA,0xC0830B7A,0x872371AA,0xBA43581A,
+        0x9932774D,0xA4525EFD,0xE3F2242D,0xDE920D9D,0x6CB2D18D,0x51D2F83D,0x167282ED,0x2B12AB5D,0xA9423C8C,0x9422153C,0xD3826FEC,0xEEE2465C,0x5CC29A4C,0x61A2B3FC,0x2602C92C,0x1B62E09C,
+        0xF9D2E0CF,0xC4B2C97F,0x8312B3AF,0xBE729A1F,0x0C52460F,0x31326FBF,0x7692156F,0x4BF23CDF,0xC9A2AB0E,0xF4C282BE,0xB362F86E,0x8E02D1DE,0x3C220DCE,0x0142247E,0x46E25EAE,0x7B82771E,
+        0xB1E6B092,0x8C869922,0xCB26E3F2,0xF646CA42,0x44661652,0x79063FE2,0x3EA64532,0x03C66C82,0x8196FB53,0xBCF6D2E3,0xFB56A833,0xC6368183,0x74165D93,0x49767423,0x0ED60EF3,0x33B62743,
+        0xD1062710,0xEC660EA0,0xABC67470,0x96A65DC0,0x248681D0,0x19E6A860,0x5E46D2B0,0x6326FB00,0xE1766CD1,0xDC164561,0x9BB63FB1,0xA6D61601,0x14F6CA11,0x2996E3A1,0x6E369971,0x5356B0C1,
+        0x70279F96,0x4D47B626,0x0AE7CCF6,0x3787E546,0x85A73956,0xB8C710E6,0xFF676A36,0xC2074386,0x4057D457,0x7D37FDE7,0x3A978737,0x07F7AE87,0xB5D77297,0x88B75B27,0xCF1721F7,0xF2770847,
+        0x10C70814,0x2DA721A4,0x6A075B74,0x576772C4,0xE547AED4,0xD8278764,0x9F87FDB4,0xA2E7D404,0x20B743D5,0x1DD76A65,0x5A7710B5,0x67173905,0xD537E515,0xE857CCA5,0xAFF7B675,0x92979FC5,
+        0xE915E8DB,0xD475C16B,0x93D5BBBB,0xAEB5920B,0x1C954E1B,0x21F567AB,0x66551D7B,0x5B3534CB,0xD965A31A,0xE4058AAA,0xA3A5F07A,0x9EC5D9CA,0x2CE505DA,0x11852C6A,0x562556BA,0x6B457F0A,
+        0x89F57F59,0xB49556E9,0xF3352C39,0xCE550589,0x7C75D999,0x4115F029,0x06B58AF9,0x3BD5A349,0xB9853498,0x84E51D28,0xC34567F8,0xFE254E48,0x4C059258,0x7165BBE8,0x36C5C138,0x0BA5E888,
+        0x28D4C7DF,0x15B4EE6F,0x521494BF,0x6F74BD0F,0xDD54611F,0xE03448AF,0xA794327F,0x9AF41BCF,0x18A48C1E,0x25C4A5AE,0x6264DF7E,0x5F04F6CE,0xED242ADE,0xD044036E,0x97E479BE,0xAA84500E,
+        0x4834505D,0x755479ED,0x32F4033D,0x0F942A8D,0xBDB4F69D,0x80D4DF2D,0xC774A5FD,0xFA148C4D,0x78441B9C,0x4524322C,0x028448FC,0x3FE4614C,0x8DC4BD5C,0xB0A494EC,0xF704EE3C,0xCA64C78C,
+    },
+    {
+        0x00000000,0xCB5CD3A5,0x4DC8A10B,0x869472AE,0x9B914216,0x50CD91B3,0xD659E31D,0x1D0530B8,0xEC53826D,0x270F51C8,0xA19B2366,0x6AC7F0C3,0x77C2C07B,0xBC9E13DE,0x3A0A6170,0xF156B2D5,
+        0x03D6029B,0xC88AD13E,0x4E1EA390,0x85427035,0x9847408D,0x531B9328,0xD58FE186,0x1ED33223,0xEF8580F6,0x24D95353,0xA24D21FD,0x6911F258,0x7414C2E0,0xBF481145,0x39DC63EB,0xF280B04E,
+        0x07AC0536,0xCCF0D693,0x4A64A43D,0x81387798,0x9C3D4720,0x57619485,0xD1F5E62B,0x1AA9358E,0xEBFF875B,0x20A354FE,0xA6372650,0x6D6BF5F5,0x706EC54D,0xBB3216E8,0x3DA66446,0xF6FAB7E3,
+        0x047A07AD,0xCF26D408,0x49B2A6A6,0x82EE7503,0x9FEB45BB,0x54B7961E,0xD223E4B0,0x197F3715,0xE82985C0,0x23755665,0xA5E124CB,0x6EBDF76E,0x73B8C7D6,0xB8E41473,0x3E7066DD,0xF52CB578,
+        0x0F580A6C,0xC404D9C9,0x4290AB67,0x89CC78C2,0x94C9487A,0x5F959BDF,0xD901E971,0x125D3AD4,0xE30B8801,0x28575BA4,0xAEC3290A,0x659FFAAF,0x789ACA17,0xB3C619B2,0x35526B1C,0xFE0EB8B9,
+        0x0C8E08F7,0xC7D2DB52,0x4146A9FC,0x8A1A7A59,0x971F4AE1,0x5C439944,0xDAD7EBEA,0x118B384F,0xE0DD8A9A,0x2B81593F,0xAD152B91,0x6649F834,0x7B4CC88C,0xB0101B29,0x36846987,0xFDD8BA22,
+        0x08F40F5A,0xC3A8DCFF,0x453CAE51,0x8E607DF4,0x93654D4C,0x58399EE9,0xDEADEC47,0x15F13FE2,0xE4A78D37,0x2FFB5E92,0xA96F2C3C,0x6233FF99,0x7F36CF21,0xB46A1C84,0x32FE6E2A,0xF9A2BD8F,
+        0x0B220DC1,0xC07EDE64,0x46EAACCA,0x8DB67F6F,0x90B34FD7,0x5BEF9C72,0xDD7BEEDC,0x16273D79,0xE7718FAC,0x2C2D5C09,0xAAB92EA7,0x61E5FD02,0x7CE0CDBA,0xB7BC1E1F,0x31286CB1,0xFA74BF14,
+        0x1EB014D8,0xD5ECC77D,0x5378B5D3,0x98246676,0x852156CE,0x4E7D856B,0xC8E9F7C5,0x03B52460,0xF2E396B5,0x39BF4510,0xBF2B37BE,0x7477E41B,0x6972D4A3,0xA22E0706,0x24BA75A8,0xEFE6A60D,
+        0x1D661643,0xD63AC5E6,0x50AEB748,0x9BF264ED,0x86F75455,0x4DAB87F0,0xCB3FF55E,0x006326FB,0xF135942E,0x3A69478B,0xBCFD3525,0x77A1E680,0x6AA4D638,0xA1F8059D,0x276C7733,0xEC30A496,
+        0x191C11EE,0xD240C24B,0x54D4B0E5,0x9F886340,0x828D53F8,0x49D1805D,0xCF45F2F3,0x04192156,0xF54F9383,0x3E134026,0xB8873288,0x73DBE12D,0x6EDED195,0xA5820230,0x2316709E,0xE84AA33B,
+        0x1ACA1375,0xD196C0D0,0x5702B27E,0x9C5E61DB,0x815B5163,0x4A0782C6,0xCC93F068,0x07CF23CD,0xF6999118,0x3DC542BD,0xBB513013,0x700DE3B6,0x6D08D30E,0xA65400AB,0x20C07205,0xEB9CA1A0,
+        0x11E81EB4,0xDAB4CD11,0x5C20BFBF,0x977C6C1A,0x8A795CA2,0x41258F07,0xC7B1FDA9,0x0CED2E0C,0xFDBB9CD9,0x36E74F7C,0xB0733DD2,0x7B2FEE77,0x662ADECF,0xAD760D6A,0x2BE27FC4,0xE0BEAC61,
+        0x123E1C2F,0xD962CF8A,0x5FF6BD24,0x94AA6E81,0x89AF5E39,0x42F38D9C,0xC467FF32,0x0F3B2C97,0xFE6D9E42,0x35314DE7,0xB3A53F49,0x78F9ECEC,0x65FCDC54,0xAEA00FF1,0x28347D5F,0xE368AEFA,
+        0x16441B82,0xDD18C827,0x5B8CBA89,0x90D0692C,0x8DD55994,0x46898A31,0xC01DF89F,0x0B412B3A,0xFA1799EF,0x314B4A4A,0xB7DF38E4,0x7C83EB41,0x6186DBF9,0xAADA085C,0x2C4E7AF2,0xE712A957,
+        0x15921919,0xDECECABC,0x585AB812,0x93066BB7,0x8E035B0F,0x455F88AA,0xC3CBFA04,0x089729A1,0xF9C19B74,0x329D48D1,0xB4093A7F,0x7F55E9DA,0x6250D962,0xA90C0AC7,0x2F987869,0xE4C4ABCC,
+    },
+    {
+        0x00000000,0xA6770BB4,0x979F1129,0x31E81A9D,0xF44F2413,0x52382FA7,0x63D0353A,0xC5A73E8E,0x33EF4E67,0x959845D3,0xA4705F4E,0x020754FA,0xC7A06A74,0x61D761C0,0x503F7B5D,0xF64870E9,
+        0x67DE9CCE,0xC1A9977A,0xF0418DE7,0x56368653,0x9391B8DD,0x35E6B369,0x040EA9F4,0xA279A240,0x5431D2A9,0xF246D91D,0xC3AEC380,0x65D9C834,0xA07EF6BA,0x0609FD0E,0x37E1E793,0x9196EC27,
+        0xCFBD399C,0x69CA3228,0x582228B5,0xFE552301,0x3BF21D8F,0x9D85163B,0xAC6D0CA6,0x0A1A0712,0xFC5277FB,0x5A257C4F,0x6BCD66D2,0xCDBA6D66,0x081D53E8,0xAE6A585C,0x9F8242C1,0x39F54975,
+        0xA863A552,0x0E14AEE6,0x3FFCB47B,0x998BBFCF,0x5C2C8141,0xFA5B8AF5,0xCBB39068,0x6DC49BDC,0x9B8CEB35,0x3DFBE081,0x0C13FA1C,0xAA64F1A8,0x6FC3CF26,0xC9B4C492,0xF85CDE0F,0x5E2BD5BB,
+        0x440B7579,0xE27C7ECD,0xD3946450,0x75E36FE4,0xB044516A,0x16335ADE,0x27DB4043,0x81AC4BF7,0x77E43B1E,0xD19330AA,0xE07B2A37,0x460C2183,0x83AB1F0D,0x25DC14B9,0x14340E24,0xB2430590,
+        0x23D5E9B7,0x85A2E203,0xB44AF89E,0x123DF32A,0xD79ACDA4,0x71EDC610,0x4005DC8D,0xE672D739,0x103AA7D0,0xB64DAC64,0x87A5B6F9,0x21D2BD4D,0xE47583C3,0x42028877,0x73EA92EA,0xD59D995E,
+        0x8BB64CE5,0x2DC14751,0x1C295DCC,0xBA5E5678,0x7FF968F6,0xD98E6342,0xE86679DF,0x4E11726B,0xB8590282,0x1E2E0936,0x2FC613AB,0x89B1181F,0x4C162691,0xEA612D25,0xDB8937B8,0x7DFE3C0C,
+        0xEC68D02B,0x4A1FDB9F,0x7BF7C102,0xDD80CAB6,0x1827F438,0xBE50FF8C,0x8FB8E511,0x29CFEEA5,0xDF879E4C,0x79F095F8,0x48188F65,0xEE6F84D1,0x2BC8BA5F,0x8DBFB1EB,0xBC57AB76,0x1A20A0C2,
+        0x8816EAF2,0x2E61E146,0x1F89FBDB,0xB9FEF06F,0x7C59CEE1,0xDA2EC555,0xEBC6DFC8,0x4DB1D47C,0xBBF9A495,0x1D8EAF21,0x2C66B5BC,0x8A11BE08,0x4FB68086,0xE9C18B32,0xD82991AF,0x7E5E9A1B,
+        0xEFC8763C,0x49BF7D88,0x78576715,0xDE206CA1,0x1B87522F,0xBDF0599B,0x8C184306,0x2A6F48B2,0xDC27385B,0x7A5033EF,0x4BB82972,0xEDCF22C6,0x28681C48,0x8E1F17FC,0xBFF70D61,0x198006D5,
+        0x47ABD36E,0xE1DCD8DA,0xD034C247,0x7643C9F3,0xB3E4F77D,0x1593FCC9,0x247BE654,0x820CEDE0,0x74449D09,0xD23396BD,0xE3DB8C20,0x45AC8794,0x800BB91A,0x267CB2AE,0x1794A833,0xB1E3A387,
+        0x20754FA0,0x86024414,0xB7EA5E89,0x119D553D,0xD43A6BB3,0x724D6007,0x43A57A9A,0xE5D2712E,0x139A01C7,0xB5ED0A73,0x840510EE,0x22721B5A,0xE7D525D4,0x41A22E60,0x704A34FD,0xD63D3F49,
+        0xCC1D9F8B,0x6A6A943F,0x5B828EA2,0xFDF58516,0x3852BB98,0x9E25B02C,0xAFCDAAB1,0x09BAA105,0xFFF2D1EC,0x5985DA58,0x686DC0C5,0xCE1ACB71,0x0BBDF5FF,0xADCAFE4B,0x9C22E4D6,0x3A55EF62,
+        0xABC30345,0x0DB408F1,0x3C5C126C,0x9A2B19D8,0x5F8C2756,0xF9FB2CE2,0xC813367F,0x6E643DCB,0x982C4D22,0x3E5B4696,0x0FB35C0B,0xA9C457BF,0x6C636931,0xCA146285,0xFBFC7818,0x5D8B73AC,
+        0x03A0A617,0xA5D7ADA3,0x943FB73E,0x3248BC8A,0xF7EF8204,0x519889B0,0x6070932D,0xC6079899,0x304FE870,0x9638E3C4,0xA7D0F959,0x01A7F2ED,0xC400CC63,0x6277C7D7,0x539FDD4A,0xF5E8D6FE,
+        0x647E3AD9,0xC209316D,0xF3E12BF0,0x55962044,0x90311ECA,0x3646157E,0x07AE0FE3,0xA1D90457,0x579174BE,0xF1E67F0A,0xC00E6597,0x66796E23,0xA3DE50AD,0x05A95B19,0x34414184,0x92364A30,
+    },
+    {
+        0x00000000,0xCCAA009E,0x4225077D,0x8E8F07E3,0x844A0EFA,0x48E00E64,0xC66F0987,0x0AC50919,0xD3E51BB5,0x1F4F1B2B,0x91C01CC8,0x5D6A1C56,0x57AF154F,0x9B0515D1,0x158A1232,0xD92012AC,
+        0x7CBB312B,0xB01131B5,0x3E9E3656,0xF23436C8,0xF8F13FD1,0x345B3F4F,0xBAD438AC,0x767E3832,0xAF5E2A9E,0x63F42A00,0xED7B2DE3,0x21D12D7D,0x2B142464,0xE7BE24FA,0x69312319,0xA59B2387,
+        0xF9766256,0x35DC62C8,0xBB53652B,0x77F965B5,0x7D3C6CAC,0xB1966C32,0x3F196BD1,0xF3B36B4F,0x2A9379E3,0xE639797D,0x68B67E9E,0xA41C7E00,0xAED97719,0x62737787,0xECFC7064,0x205670FA,
+        0x85CD537D,0x496753E3,0xC7E85400,0x0B42549E,0x01875D87,0xCD2D5D19,0x43A25AFA,0x8F085A64,0x562848C8,0x9A824856,0x140D4FB5,0xD8A74F2B,0xD2624632,0x1EC846AC,0x9047414F,0x5CED41D1,
+        0x299DC2ED,0xE537C273,0x6BB8C590,0xA712C50E,0xADD7CC17,0x617DCC89,0xEFF2CB6A,0x2358CBF4,0xFA78D958,0x36D2D9C6,0xB85DDE25,0x74F7DEBB,0x7E32D7A2,0xB298D73C,0x3C17D0DF,0xF0BDD041,
+        0x5526F3C6,0x998CF358,0x1703F4BB,0xDBA9F425,0xD16CFD3C,0x1DC6FDA2,0x9349FA41,0x5FE3FADF,0x86C3E873,0x4A69E8ED,0xC4E6EF0E,0x084CEF90,0x0289E689,0xCE23E617,0x40ACE1F4,0x8C06E16A,
+        0xD0EBA0BB,0x1C41A025,0x92CEA7C6,0x5E64A758,0x54A1AE41,0x980BAEDF,0x1684A93C,0xDA2EA9A2,0x030EBB0E,0xCFA4BB90,0x412BBC73,0x8D81BCED,0x8744B5F4,0x4BEEB56A,0xC561B289,0x09CBB217,
+        0xAC509190,0x60FA910E,0xEE7596ED,0x22DF9673,0x281A9F6A,0xE4B09FF4,0x6A3F9817,0xA6959889,0x7FB58A25,0xB31F8ABB,0x3D908D58,0xF13A8DC6,0xFBFF84DF,0x37558441,0xB9DA83A2,0x7570833C,
+        0x533B85DA,0x9F918544,0x111E82A7,0xDDB48239,0xD7718B20,0x1BDB8BBE,0x95548C5D,0x59FE8CC3,0x80DE9E6F,0x4C749EF1,0xC2FB9912,0x0E51998C,0x04949095,0xC83E900B,0x46B197E8,0x8A1B9776,
+        0x2F80B4F1,0xE32AB46F,0x6DA5B38C,0xA10FB312,0xABCABA0B,0x6760BA95,0xE9EFBD76,0x2545BDE8,0xFC65AF44,0x30CFAFDA,0xBE40A839,0x72EAA8A7,0x782FA1BE,0xB485A120,0x3A0AA6C3,0xF6A0A65D,
+        0xAA4DE78C,0x66E7E712,0xE868E0F1,0x24C2E06F,0x2E07E976,0xE2ADE9E8,0x6C22EE0B,0xA088EE95,0x79A8FC39,0xB502FCA7,0x3B8DFB44,0xF727FBDA,0xFDE2F2C3,0x3148F25D,0xBFC7F5BE,0x736DF520,
+        0xD6F6D6A7,0x1A5CD639,0x94D3D1DA,0x5879D144,0x52BCD85D,0x9E16D8C3,0x1099DF20,0xDC33DFBE,0x0513CD12,0xC9B9CD8C,0x4736CA6F,0x8B9CCAF1,0x8159C3E8,0x4DF3C376,0xC37CC495,0x0FD6C40B,
+        0x7AA64737,0xB60C47A9,0x3883404A,0xF42940D4,0xFEEC49CD,0x32464953,0xBCC94EB0,0x70634E2E,0xA9435C82,0x65E95C1C,0xEB665BFF,0x27CC5B61,0x2D095278,0xE1A352E6,0x6F2C5505,0xA386559B,
+        0x061D761C,0xCAB77682,0x44387161,0x889271FF,0x825778E6,0x4EFD7878,0xC0727F9B,0x0CD87F05,0xD5F86DA9,0x19526D37,0x97DD6AD4,0x5B776A4A,0x51B26353,0x9D1863CD,0x1397642E,0xDF3D64B0,
+        0x83D02561,0x4F7A25FF,0xC1F5221C,0x0D5F2282,0x079A2B9B,0xCB302B05,0x45BF2CE6,0x89152C78,0x50353ED4,0x9C9F3E4A,0x121039A9,0xDEBA3937,0xD47F302E,0x18D530B0,0x965A3753,0x5AF037CD,
+        0xFF6B144A,0x33C114D4,0xBD4E1337,0x71E413A9,0x7B211AB0,0xB78B1A2E,0x39041DCD,0xF5AE1D53,0x2C8E0FFF,0xE0240F61,0x6EAB0882,0xA201081C,0xA8C40105,0x646E019B,0xEAE10678,0x264B06E6,
+    },
+};
+
+// Update an inverted CRC with 1 byte or 8 bytes.
+// Default: CRC32 (8 bytes using slicing-by-8), matching the byte-at-a-time table implementation. With IMGUI_USE_CRC32C_HASH: hardware CRC32C.
+static inline ImU32 ImHashCrc32Update1(ImU32 crc, unsigned char c)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC)
+    return _mm_crc32_u8(crc, c);
+#elif defined(IMGUI_ENABLE_ARM_CRC)
+    return __crc32cb(crc, c);
+#else
+    return (crc >> 8) ^ GCrc32LookupTable[(crc & 0xFF) ^ c];
+#endif
+}
+
+static inline ImU32 ImHashCrc32Update8(ImU32 crc, const unsigned char* data)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC) && (defined(__x86_64__) || defined(_M_X64))
+    ImU64 v;
+    memcpy(&v, data, 8);
+    return (ImU32)_mm_crc32_u64(crc, v);
+#elif defined(IMGUI_ENABLE_SSE4_2_CRC)
+    ImU32 v[2];
+    memcpy(v, data, 8);
+    return _mm_crc32_u32(_mm_crc32_u32(crc, v[0]), v[1]);
+#elif defined(IMGUI_ENABLE_ARM_CRC)
+    ImU64 v;
+    memcpy(&v, data, 8);
+    return __crc32cd(crc, v);
+#else
+    const ImU32 (*lut)[256] = GCrc32SliceBy8LookupTable;
+    ImU32 lo = crc ^ ((ImU32)data[0] | ((ImU32)data[1] << 8) | ((ImU32)data[2] << 16) | ((ImU32)data[3] << 24));
+    ImU32 hi = (ImU32)data[4] | ((ImU32)data[5] << 8) | ((ImU32)data[6] << 16) | ((ImU32)data[7] << 24);
+    return lut[6][lo & 0xFF] ^ lut[5][(lo >> 8) & 0xFF] ^ lut[4][(lo >> 16) & 0xFF] ^ lut[3][lo >> 24]
+         ^ lut[2][hi & 0xFF] ^ lut[1][(hi >> 8) & 0xFF] ^ lut[0][(hi >> 16) & 0xFF] ^ GCrc32LookupTable[hi >> 24];
+#endif
+}
+
+// Update an inverted CRC with 'size' zero bytes, which is equivalent to multiplying it by x^(8*size) modulo the CRC polynomial.
+// Default: 4 lookups per 8 bytes (a slicing-by-8 step with zero data) + 4 lookups for the remainder.
+static inline ImU32 ImHashCrc32UpdateZeros(ImU32 crc, size_t size)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC) || defined(IMGUI_ENABLE_ARM_CRC)
+    const unsigned char zeros[8] = {};
+    for (; size >= 8; size -= 8)
+        crc = ImHashCrc32Update8(crc, zeros);
+    while (size-- != 0)
+        crc = ImHashCrc32Update1(crc, 0);
+    return crc;
+#else
+    const ImU32 (*lut)[256] = GCrc32SliceBy8LookupTable;
+    for (; size >= 8; size -= 8)
+        crc = lut[6][crc & 0xFF] ^ lut[5][(crc >> 8) & 0xFF] ^ lut[4][(crc >> 16) & 0xFF] ^ lut[3][crc >> 24];
+    if (size == 0)
+        return crc;
+
+    // Byte 'n' of the CRC is followed by (size - 1 - n) zero bytes. With less than 4 zero bytes, the upper bytes are only shifted down.
+    ImU32 result = (size < 4) ? (crc >> (size * 8)) : 0;
+    for (size_t n = 0; n < 4 && n < size; n++)
+    {
+        const size_t zeros_after = size - 1 - n;
+        const ImU32* table = (zeros_after == 0) ? GCrc32LookupTable : lut[zeros_after - 1];
+        result ^= table[(crc >> (n * 8)) & 0xFF];
+    }
+    return result;
+#endif
+}
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+        crc = ImHashCrc32Update8(crc, data);
     while (data_size-- != 0)
-        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+        crc = ImHashCrc32Update1(crc, *data++);
     return ~crc;
 }
 
+// Return true if the next 8 bytes contain no '#' (branchless)
+static inline bool ImHashStrIsPlainBlock8(const unsigned char* data)
+{
+    ImU64 v;
+    memcpy(&v, data, 8);
+    v ^= 0x2323232323232323ULL; // '#' bytes become zero
+    return ((v - 0x0101010101010101ULL) & ~v & 0x8080808080808080ULL) == 0;
+}
+
+// Combine a CRC computed from a zero state over 'data_size' bytes (e.g. at compile time, see ImGuiLabelLiteral) with a seed.
+// CRC is linear, so CRC(seed, data) == CRC(seed, zeros) ^ CRC(0, data): this returns the same value as ImHashData(data, data_size, seed).
+ImGuiID ImHashCombine(ImU32 crc, size_t data_size, ImU32 seed)
+{
+    return ~(ImHashCrc32UpdateZeros(~seed, data_size) ^ crc);
+}
+
 // Zero-terminated string hash, with support for ### to reset back to seed value
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
+// - Short zero-terminated strings are hashed one byte at a time while looking for the terminator, as calling strlen() would cost more.
+// - Longer strings are hashed 8 bytes at a time, except for blocks containing a '#' which are hashed one byte at a time.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    if (data_size != 0)
+    if (data_size == 0)
     {
-        while (data_size-- != 0)
+        for (int n = 0; n < 8; n++)
         {
             unsigned char c = *data++;
-            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+            if (c == 0)
+                return ~crc;
+            if (c == '#' && data[0] == '#' && data[1] == '#')
                 crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+            crc = ImHashCrc32Update1(crc, c);
         }
+        data_size = strlen((const char*)data);
     }
-    else
+    while (data_size != 0)
     {
-        while (unsigned char c = *data++)
+        size_t block_size = (data_size >= 8) ? 8 : data_size;
+        if (block_size == 8 && ImHashStrIsPlainBlock8(data))
         {
-            if (c == '#' && data[0] == '#' && data[1] == '#')
+            crc = ImHashCrc32Update8(crc, data);
+            data += 8;
+            data_size -= 8;
+            continue;
+        }
+        for (size_t n = 0; n < block_size; n++)
+        {
+            unsigned char c = *data++;
+            data_size--;
+            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
                 crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+            crc = ImHashCrc32Update1(crc, c);
         }
     }
     return ~crc;
@@ -1880,6 +2345,21 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (Time functions)
+//-----------------------------------------------------------------------------
+
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+ImU64   ImTimeGetTicks()            { LARGE_INTEGER ticks; ::QueryPerformanceCounter(&ticks); return (ImU64)ticks.QuadPart; }
+ImU64   ImTimeGetTicksPerSecond()   { LARGE_INTEGER frequency; ::QueryPerformanceFrequency(&frequency); return (ImU64)frequency.QuadPart; }
+#elif defined(CLOCK_MONOTONIC)
+ImU64   ImTimeGetTicks()            { struct timespec ts; clock_gettime(CLOCK_MONOTONIC, &ts); return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec; }
+ImU64   ImTimeGetTicksPerSecond()   { return 1000000000; }
+#else
+ImU64   ImTimeGetTicks()            { return (ImU64)clock(); } // Low resolution fallback
+ImU64   ImTimeGetTicksPerSecond()   { return (ImU64)CLOCKS_PER_SEC; }
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -1939,12 +2419,48 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// Find end of a run of printable ASCII characters (0x20..0x7F), which make the bulk of most text and don't need UTF-8 decoding.
+// Stop at control characters (including the zero terminator) and at first byte of multi-byte UTF-8 sequences.
+const char* ImTextFindNonPrintableAscii(const char* in_text, const char* in_text_end)
+{
+#ifdef IMGUI_ENABLE_SSE
+    const __m128i v_space = _mm_set1_epi8(' ');
+    while (in_text_end - in_text >= 16)
+    {
+        // Signed comparison: bytes >= 0x80 are negative so are also lower than ' '
+        const __m128i v_text = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+        int mask = _mm_movemask_epi8(_mm_cmplt_epi8(v_text, v_space));
+        if (mask != 0)
+        {
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                in_text++;
+            }
+            return in_text;
+        }
+        in_text += 16;
+    }
+#endif
+    while (in_text < in_text_end && (signed char)*in_text >= ' ')
+        in_text++;
+    return in_text;
+}
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Fast path for runs of printable ASCII characters
+        if ((signed char)*in_text >= ' ' && in_text_end != NULL)
+        {
+            const char* run_end = ImTextFindNonPrintableAscii(in_text, ImMin(in_text_end, in_text + (buf_end - 1 - buf_out)));
+            while (in_text < run_end)
+                *buf_out++ = (ImWchar)(unsigned char)*in_text++;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
@@ -1962,6 +2478,14 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
     int char_count = 0;
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Fast path for runs of printable ASCII characters
+        if ((signed char)*in_text >= ' ' && in_text_end != NULL)
+        {
+            const char* run_end = ImTextFindNonPrintableAscii(in_text, in_text_end);
+            char_count += (int)(run_end - in_text);
+            in_text = run_end;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
@@ -2034,8 +2558,28 @@ int ImTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, con
 {
     char* buf_p = out_buf;
     const char* buf_end = out_buf + out_buf_size;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_WCHAR32)
+    const __m128i v_ascii_min = _mm_set1_epi16(0x01);
+    const __m128i v_ascii_max = _mm_set1_epi16(0x7F);
+#endif
     while (buf_p < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_WCHAR32)
+        // Fast path: convert 8 ASCII characters at a time
+        if (in_text_end != NULL && in_text_end - in_text >= 8 && buf_end - 1 - buf_p >= 8)
+        {
+            // Signed comparisons: values >= 0x8000 are negative
+            const __m128i v_text = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+            const __m128i v_not_ascii = _mm_or_si128(_mm_cmpgt_epi16(v_text, v_ascii_max), _mm_cmplt_epi16(v_text, v_ascii_min));
+            if (_mm_movemask_epi8(v_not_ascii) == 0)
+            {
+                _mm_storel_epi64((__m128i*)(void*)buf_p, _mm_packus_epi16(v_text, v_text));
+                in_text += 8;
+                buf_p += 8;
+                continue;
+            }
+        }
+#endif
         unsigned int c = (unsigned int)(*in_text++);
         if (c < 0x80)
             *buf_p++ = (char)c;
@@ -2150,6 +2694,8 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
+#ifndef IMGUI_USE_HASHED_STORAGE
+
 // std::lower_bound but without the bullshit
 static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
 {
@@ -2173,28 +2719,112 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = const_cast<ImVector<ImGuiStorage::ImGuiStoragePair>&>(storage->Data);
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(data, key);
+    return (it == data.end() || it->key != key) ? NULL : it;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& new_pair)
+{
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, new_pair.key);
+    if (it == storage->Data.end() || it->key != new_pair.key)
+        it = storage->Data.insert(it, new_pair);
+    return it;
+}
+
+#else
+
+// Fibonacci hashing: keys are often already hashes, but may also be small sequential integers.
+static inline int StorageHashSlot(ImGuiID key, int table_mask)
+{
+    const ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 15)) & (ImU32)table_mask);
+}
+
+// Return the slot holding 'key', or the empty slot where it would be inserted
+static int StorageFindSlot(const ImGuiStorage* storage, ImGuiID key)
+{
+    const int table_mask = storage->HashTable.Size - 1;
+    for (int slot = StorageHashSlot(key, table_mask); ; slot = (slot + 1) & table_mask)
+    {
+        const int idx = storage->HashTable.Data[slot];
+        if (idx == 0 || storage->Data.Data[idx - 1].key == key)
+            return slot;
+    }
+}
+
+// Maximum load factor 0.5. With duplicate keys (only possible when pushing to Data[] directly) the first one is found, like with the sorted storage.
+static void StorageRebuildHashTable(ImGuiStorage* storage, int pairs_count)
+{
+    int table_size = 16;
+    while (table_size < pairs_count * 2)
+        table_size <<= 1;
+    storage->HashTable.resize(table_size);
+    memset(storage->HashTable.Data, 0, (size_t)storage->HashTable.size_in_bytes());
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        const int slot = StorageFindSlot(storage, storage->Data.Data[n].key);
+        if (storage->HashTable.Data[slot] == 0)
+            storage->HashTable.Data[slot] = n + 1;
+    }
+    storage->HashedCount = storage->Data.Size;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->HashedCount != storage->Data.Size)
+        StorageRebuildHashTable(const_cast<ImGuiStorage*>(storage), storage->Data.Size);
+    if (storage->Data.Size == 0)
+        return NULL;
+    const int idx = storage->HashTable.Data[StorageFindSlot(storage, key)];
+    return idx ? &storage->Data.Data[idx - 1] : NULL;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& new_pair)
+{
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
+    if (storage->HashedCount != storage->Data.Size || (storage->Data.Size + 1) * 2 > storage->HashTable.Size)
+        StorageRebuildHashTable(storage, storage->Data.Size + 1);
+    const int slot = StorageFindSlot(storage, new_pair.key);
+    if (const int idx = storage->HashTable.Data[slot])
+        return &storage->Data.Data[idx - 1];
+    storage->Data.push_back(new_pair);
+    storage->HashTable.Data[slot] = storage->Data.Size;
+    storage->HashedCount = storage->Data.Size;
+    return &storage->Data.back();
+}
+
+#endif // #ifndef IMGUI_USE_HASHED_STORAGE
+
+static bool   StoragePairLessByKey(const ImGuiStorage::ImGuiStoragePair& a, const ImGuiStorage::ImGuiStoragePair& b) { return a.key < b.key; }
+static ImU32  StoragePairGetKey(const ImGuiStorage::ImGuiStoragePair& pair)                                             { return pair.key; }
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
-    struct StaticFunc
+    // Radix sort requires a temporary buffer, only worth it for larger storages
+    if (Data.Size < 256)
     {
-        static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
-        {
-            // We can't just do a subtraction because qsort uses signed integers and subtracting our ID doesn't play well with that.
-            if (((const ImGuiStoragePair*)lhs)->key > ((const ImGuiStoragePair*)rhs)->key) return +1;
-            if (((const ImGuiStoragePair*)lhs)->key < ((const ImGuiStoragePair*)rhs)->key) return -1;
-            return 0;
-        }
-    };
-    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+        ImSort<ImGuiStoragePair, StoragePairLessByKey>(Data.Data, Data.Size);
+    }
+    else
+    {
+        ImGuiStoragePair* temp_buffer = (ImGuiStoragePair*)IM_ALLOC((size_t)Data.Size * sizeof(ImGuiStoragePair));
+        ImSortRadix<ImGuiStoragePair, StoragePairGetKey>(Data.Data, Data.Size, temp_buffer);
+        IM_FREE(temp_buffer);
+    }
+#ifdef IMGUI_USE_HASHED_STORAGE
+    StorageRebuildHashTable(this, Data.Size);
+#endif
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2204,27 +2834,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2234,30 +2857,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2267,24 +2877,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2343,6 +2941,12 @@ void ImGuiTextFilter::Build()
     ImGuiTextRange input_range(InputBuf, InputBuf + strlen(InputBuf));
     input_range.split(',', &Filters);
 
+    // Precompile terms for PassFilter(): upper-case needles, so matching only needs to convert the searched text.
+    TermsUpper.resize((int)(input_range.e - input_range.b) + 1);
+    for (int n = 0; n < TermsUpper.Size; n++)
+        TermsUpper[n] = ImToUpper(InputBuf[n]);
+    Terms.resize(0);
+
     CountGrep = 0;
     for (int i = 0; i != Filters.Size; i++)
     {
@@ -2355,7 +2959,53 @@ void ImGuiTextFilter::Build()
             continue;
         if (Filters[i].b[0] != '-')
             CountGrep += 1;
+
+        ImGuiTextFilterTerm term;
+        term.Exclude = (f.b[0] == '-');
+        term.Offset = (int)(f.b - InputBuf) + (term.Exclude ? 1 : 0);
+        term.Len = (int)(f.e - InputBuf) - term.Offset;
+        if (term.Len > 0)
+            Terms.push_back(term);
+    }
+}
+
+static inline bool ImStrEqualsUpper(const char* str, const char* str_upper, int len)
+{
+    for (int n = 0; n < len; n++)
+        if (ImToUpper(str[n]) != str_upper[n])
+            return false;
+    return true;
+}
+
+// Case-insensitive search for an upper-case needle (ASCII case folding, same as ImStristr() in the default "C" locale)
+// With SSE2: find candidate positions 16 at a time by comparing the first and last characters of the needle in both cases.
+static const char* ImStristrUpper(const char* haystack, const char* haystack_end, const char* needle_upper, int needle_len)
+{
+    IM_ASSERT(needle_len > 0);
+    const char first = needle_upper[0];
+#ifdef IMGUI_ENABLE_SSE
+    const char last = needle_upper[needle_len - 1];
+    const __m128i v_first_upper = _mm_set1_epi8(first);
+    const __m128i v_first_lower = _mm_set1_epi8(ImToLower(first));
+    const __m128i v_last_upper = _mm_set1_epi8(last);
+    const __m128i v_last_lower = _mm_set1_epi8(ImToLower(last));
+    while (haystack_end - haystack >= needle_len - 1 + 16)
+    {
+        const __m128i v_text_first = _mm_loadu_si128((const __m128i*)(const void*)haystack);
+        const __m128i v_text_last = _mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1));
+        const __m128i v_match_first = _mm_or_si128(_mm_cmpeq_epi8(v_text_first, v_first_upper), _mm_cmpeq_epi8(v_text_first, v_first_lower));
+        const __m128i v_match_last = _mm_or_si128(_mm_cmpeq_epi8(v_text_last, v_last_upper), _mm_cmpeq_epi8(v_text_last, v_last_lower));
+        int mask = _mm_movemask_epi8(_mm_and_si128(v_match_first, v_match_last));
+        for (int n = 0; mask != 0; n++, mask >>= 1)
+            if ((mask & 1) && ImStrEqualsUpper(haystack + n + 1, needle_upper + 1, needle_len - 2))
+                return haystack + n;
+        haystack += 16;
     }
+#endif
+    for (; haystack_end - haystack >= needle_len; haystack++)
+        if (ImToUpper(*haystack) == first && ImStrEqualsUpper(haystack + 1, needle_upper + 1, needle_len - 1))
+            return haystack;
+    return NULL;
 }
 
 bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
@@ -2364,25 +3014,15 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
         return true;
 
     if (text == NULL)
-        text = "";
+        text = text_end = "";
+    else if (text_end == NULL)
+        text_end = text + strlen(text);
 
-    for (int i = 0; i != Filters.Size; i++)
+    for (int i = 0; i != Terms.Size; i++)
     {
-        const ImGuiTextRange& f = Filters[i];
-        if (f.empty())
-            continue;
-        if (f.b[0] == '-')
-        {
-            // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
-                return false;
-        }
-        else
-        {
-            // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
-                return true;
-        }
+        const ImGuiTextFilterTerm& term = Terms[i];
+        if (ImStristrUpper(text, text_end, TermsUpper.Data + term.Offset, term.Len) != NULL)
+            return !term.Exclude; // Subtract or Grep
     }
 
     // Implicit * grep
@@ -2392,8 +3032,21 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+void ImGuiTextFilter::PassFilterBatch(const char* const* texts, const char* const* texts_end, int texts_count, ImU32* out_bits) const
+{
+    for (int word_n = 0; word_n * 32 < texts_count; word_n++)
+    {
+        ImU32 bits = 0;
+        const int n_end = ImMin(word_n * 32 + 32, texts_count);
+        for (int n = word_n * 32; n < n_end; n++)
+            if (PassFilter(texts[n], texts_end ? texts_end[n] : NULL))
+                bits |= (ImU32)1 << (n & 31);
+        out_bits[word_n] = bits;
+    }
+}
+
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
 
 // On some platform vsnprintf() takes va_list by reference and modifies it.
@@ -2461,6 +3114,44 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+// Index lines of the [old_size, new_size) range appended to a text buffer.
+void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
+{
+    IM_ASSERT(old_size >= 0 && new_size >= old_size && new_size >= EndOffset);
+    if (old_size == new_size)
+        return;
+    if (EndOffset == 0 || base[EndOffset - 1] == '\n')
+        LineOffsets.push_back(EndOffset);
+    const char* base_end = base + new_size;
+    for (const char* p = base + old_size; (p = (const char*)memchr(p, '\n', base_end - p)) != 0; )
+        if (++p < base_end) // Don't push a trailing offset on last \n
+            LineOffsets.push_back((int)(p - base));
+    EndOffset = ImMax(EndOffset, new_size);
+}
+
+// Return width of widest line, rounded up like CalcTextSize().
+// Lines are only measured once: only lines appended since last call are measured, unless font, font size or font atlas changed.
+// The last line is measured every call as it may still be extended by append().
+float ImGuiTextIndex::CalcMaxLineWidth(const char* base, ImFont* font, float font_size)
+{
+    const int font_atlas_build_id = font->ContainerAtlas ? font->ContainerAtlas->BuildId : 0;
+    if (font != MaxLineWidthFont || font_size != MaxLineWidthFontSize || font_atlas_build_id != MaxLineWidthFontAtlasBuildId)
+    {
+        MaxLineWidth = 0.0f;
+        MaxLineWidthLines = 0;
+        MaxLineWidthFont = font;
+        MaxLineWidthFontSize = font_size;
+        MaxLineWidthFontAtlasBuildId = font_atlas_build_id;
+    }
+    for (; MaxLineWidthLines < LineOffsets.Size - 1; MaxLineWidthLines++)
+        MaxLineWidth = ImMax(MaxLineWidth, font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, get_line_begin(base, MaxLineWidthLines), get_line_end(base, MaxLineWidthLines)).x);
+
+    float max_width = MaxLineWidth;
+    if (LineOffsets.Size > 0)
+        max_width = ImMax(max_width, font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, get_line_begin(base, LineOffsets.Size - 1), get_line_end(base, LineOffsets.Size - 1)).x);
+    return IM_FLOOR(max_width + 0.99999f);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be and really confusing/spaghetti, mostly because we changed
@@ -3066,6 +3757,50 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
     }
 }
 
+// Same as RenderTextWrapped() using pre-calculated line breaks, which allows skipping lines outside of the clipping rectangle.
+// Lines are positioned at 'floor(pos.y) + line_no * FontSize', which ImFont::RenderText() floors again. This only matches
+// RenderTextWrapped() (which floors once and accumulates line heights) for an integer line height, otherwise we fall back to it.
+void ImGui::RenderTextWrappedLayout(ImVec2 pos, const char* text, const ImGuiWrappedTextLayout* layout)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImDrawList* draw_list = window->DrawList;
+    if (layout->FontSize != IM_FLOOR(layout->FontSize))
+    {
+        RenderTextWrapped(pos, text, text + layout->Text.Size, layout->WrapWidth);
+        return;
+    }
+
+    const ImU32 col = GetColorU32(ImGuiCol_Text);
+    if ((col & IM_COL32_A_MASK) != 0)
+    {
+        IM_ASSERT(layout->Font->ContainerAtlas->TexID == draw_list->_CmdHeader.TextureId);
+        const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+        const float line_height = layout->FontSize;
+        const float y = IM_FLOOR(pos.y);
+        const int lines_count = layout->LineOffsets.Size / 2;
+
+        // Skip lines above clipping rectangle. Start one line earlier as glyphs may overflow their line (e.g. descenders).
+        // As we do the vertical culling, RenderText() is given an unbounded top to not skip that line.
+        int line_no = 0;
+        if (y + line_height < clip_rect.y)
+            line_no = ImClamp((int)ImCeil((clip_rect.y - y) / line_height) - 2, 0, lines_count);
+        const ImVec4 line_clip_rect(clip_rect.x, -FLT_MAX, clip_rect.z, clip_rect.w);
+        for (; line_no < lines_count; line_no++)
+        {
+            const float line_y = y + line_no * line_height;
+            if (line_y > clip_rect.w)
+                break;
+            const char* line_begin = text + layout->LineOffsets[line_no * 2];
+            const char* line_end = text + layout->LineOffsets[line_no * 2 + 1];
+            if (line_begin != line_end)
+                layout->Font->RenderText(draw_list, layout->FontSize, ImVec2(pos.x, line_y), col, line_clip_rect, line_begin, line_end);
+        }
+    }
+    if (g.LogEnabled)
+        LogRenderedText(&pos, text, text + layout->Text.Size);
+}
+
 // Default clip_rect uses (pos_min,pos_max)
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
@@ -3311,11 +4046,13 @@ ImGuiWindow::~ImGuiWindow()
     ColumnsStorage.clear_destruct();
 }
 
+// 'str_end' == NULL: zero-terminated string. An empty range (str == str_end) is hashed as an empty string without reading 'str'.
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
+    ImGuiID id = (str == str_end) ? ImHashData(str, 0, seed) : ImHashStr(str, str_end ? (str_end - str) : 0, seed);
     ImGuiContext& g = *GImGui;
+    g.FrameStatsCurrent.IdHashCalls++;
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_String, str, str_end);
     return id;
@@ -3326,6 +4063,7 @@ ImGuiID ImGuiWindow::GetID(const void* ptr)
     ImGuiID seed = IDStack.back();
     ImGuiID id = ImHashData(&ptr, sizeof(void*), seed);
     ImGuiContext& g = *GImGui;
+    g.FrameStatsCurrent.IdHashCalls++;
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_Pointer, ptr, NULL);
     return id;
@@ -3336,11 +4074,23 @@ ImGuiID ImGuiWindow::GetID(int n)
     ImGuiID seed = IDStack.back();
     ImGuiID id = ImHashData(&n, sizeof(n), seed);
     ImGuiContext& g = *GImGui;
+    g.FrameStatsCurrent.IdHashCalls++;
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_S32, (void*)(intptr_t)n, NULL);
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiLabelLiteral& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashCombine(label.HashCrc, label.HashSize, seed);
+    ImGuiContext& g = *GImGui;
+    g.FrameStatsCurrent.IdHashCalls++;
+    if (g.DebugHookIdInfo == id)
+        ImGui::DebugHookIdInfo(id, ImGuiDataType_String, label.Label, NULL);
+    return id;
+}
+
 // This is only used in rare/specific situations to manufacture an ID out of nowhere.
 ImGuiID ImGuiWindow::GetIDFromRectangle(const ImRect& r_abs)
 {
@@ -3660,12 +4410,60 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+// Header stored in front of each allocation. Its size preserves the alignment provided by the allocator, up to IMGUI_MEM_TRACKING_HEADER_SIZE.
+struct ImGuiMemAllocHeader
+{
+    size_t      Size;
+    ImGuiMemTag Tag;
+};
+#ifndef IMGUI_MEM_TRACKING_HEADER_SIZE
+#define IMGUI_MEM_TRACKING_HEADER_SIZE  16
+#endif
+IM_STATIC_ASSERT(sizeof(ImGuiMemAllocHeader) <= IMGUI_MEM_TRACKING_HEADER_SIZE && (IMGUI_MEM_TRACKING_HEADER_SIZE & (IMGUI_MEM_TRACKING_HEADER_SIZE - 1)) == 0);
+
+static void MemTrackAlloc(ImGuiMemTagAtomicStats* stats, size_t size)
+{
+    const size_t bytes_current = (stats->BytesCurrent += size);
+    size_t bytes_peak = stats->BytesPeak.load();
+    while (bytes_current > bytes_peak && !stats->BytesPeak.compare_exchange_weak(bytes_peak, bytes_current)) {}
+    stats->AllocsCurrent++;
+    stats->AllocsTotal++;
+    stats->AllocsThisFrame++;
+}
+
+static void MemTrackFree(ImGuiMemTagAtomicStats* stats, size_t size)
+{
+    stats->BytesCurrent -= size;
+    stats->AllocsCurrent--;
+}
+
+ImGuiMemTagScope::ImGuiMemTagScope(ImGuiMemTag tag)     { BackupTag = GImAllocatorTag; GImAllocatorTag = tag; }
+ImGuiMemTagScope::~ImGuiMemTagScope()                   { GImAllocatorTag = BackupTag; }
+#endif
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
+    {
         ctx->IO.MetricsActiveAllocations++;
+        ctx->FrameStatsCurrent.Allocations++;
+        ctx->FrameStatsCurrent.AllocatedBytes += size;
+    }
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    char* ptr = (char*)(*GImAllocatorAllocFunc)(size + IMGUI_MEM_TRACKING_HEADER_SIZE, GImAllocatorUserData);
+    if (ptr == NULL)
+        return NULL;
+    ImGuiMemAllocHeader* header = (ImGuiMemAllocHeader*)(void*)ptr;
+    header->Size = size;
+    header->Tag = GImAllocatorTag;
+    MemTrackAlloc(&GImAllocatorStats[header->Tag], size);
+    MemTrackAlloc(&GImAllocatorStats[ImGuiMemTag_COUNT], size);
+    return ptr + IMGUI_MEM_TRACKING_HEADER_SIZE;
+#else
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3674,9 +4472,46 @@ void ImGui::MemFree(void* ptr)
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
             ctx->IO.MetricsActiveAllocations--;
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    if (ptr)
+    {
+        ptr = (char*)ptr - IMGUI_MEM_TRACKING_HEADER_SIZE;
+        const ImGuiMemAllocHeader* header = (const ImGuiMemAllocHeader*)ptr;
+        MemTrackFree(&GImAllocatorStats[header->Tag], header->Size);
+        MemTrackFree(&GImAllocatorStats[ImGuiMemTag_COUNT], header->Size);
+    }
+#endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+// Return a snapshot of the allocation counters. Counters are read one by one while other threads may keep allocating.
+ImGuiMemStats ImGui::GetAllocatorStats()
+{
+    ImGuiMemStats out_stats;
+    for (int n = 0; n <= ImGuiMemTag_COUNT; n++)
+    {
+        const ImGuiMemTagAtomicStats& src = GImAllocatorStats[n];
+        ImGuiMemTagStats& dst = (n < ImGuiMemTag_COUNT) ? out_stats.Tags[n] : out_stats.Total;
+        dst.BytesCurrent = src.BytesCurrent;
+        dst.BytesPeak = src.BytesPeak;
+        dst.AllocsCurrent = src.AllocsCurrent;
+        dst.AllocsTotal = src.AllocsTotal;
+        dst.AllocsThisFrame = src.AllocsThisFrame;
+        dst.AllocsLastFrame = src.AllocsLastFrame;
+    }
+    return out_stats;
+}
+
+const char* ImGui::GetMemTagName(ImGuiMemTag tag)
+{
+    const char* names[] = { "Other", "Windows", "DrawLists", "Tables", "Fonts", "InputText", "Settings", "Logging" };
+    IM_STATIC_ASSERT(ImGuiMemTag_COUNT == IM_ARRAYSIZE(names));
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    return names[tag];
+}
+#endif
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3792,6 +4627,21 @@ ImDrawData* ImGui::GetDrawData()
     return viewport->DrawDataP.Valid ? &viewport->DrawDataP : NULL;
 }
 
+const ImGuiFrameStats& ImGui::GetFrameStats()
+{
+    return GImGui->FrameStats;
+}
+
+// Return time since the beginning of the current phase in milliseconds, and start the next phase
+static float FrameStatsEndPhase()
+{
+    ImGuiContext& g = *GImGui;
+    const ImU64 ticks = ImTimeGetTicks();
+    const float ms = (float)((double)(ticks - g.FrameStatsPhaseTicks) * 1000.0 / (double)ImTimeGetTicksPerSecond());
+    g.FrameStatsPhaseTicks = ticks;
+    return ms;
+}
+
 double ImGui::GetTime()
 {
     return GImGui->Time;
@@ -3804,6 +4654,8 @@ int ImGui::GetFrameCount()
 
 static ImDrawList* GetViewportDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawLists);
+
     // Create the draw list on demand, because they are not frequently used for all viewports
     ImGuiContext& g = *GImGui;
     IM_ASSERT(drawlist_no < IM_ARRAYSIZE(viewport->DrawLists));
@@ -4332,6 +5184,19 @@ void ImGui::NewFrame()
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
 
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame();
+#endif
+    IMGUI_PROFILER_ZONE_BEGIN("NewFrame");
+
+    // Start accumulating statistics for the new frame
+    g.FrameStatsCurrent = ImGuiFrameStats();
+    g.FrameStatsPhaseTicks = ImTimeGetTicks();
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    for (int n = 0; n <= ImGuiMemTag_COUNT; n++)
+        GImAllocatorStats[n].AllocsLastFrame = GImAllocatorStats[n].AllocsThisFrame.exchange(0);
+#endif
+
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
     for (int n = g.Hooks.Size - 1; n >= 0; n--)
@@ -4349,10 +5214,25 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.FrameStatsCurrent.FrameCount = g.FrameCount;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
+    // Update text size cache statistics. Free it when disabled.
+    ImGuiTextSizeCache& text_size_cache = g.TextSizeCache;
+    text_size_cache.HitsLastFrame = text_size_cache.HitsThisFrame;
+    text_size_cache.MissesLastFrame = text_size_cache.MissesThisFrame;
+    text_size_cache.HitsThisFrame = text_size_cache.MissesThisFrame = 0;
+    if (!g.IO.ConfigTextSizeCache && !text_size_cache.Entries.empty())
+        text_size_cache.Clear();
+
+    // Discard unused word-wrapped text layouts
+    if (g.IO.ConfigWrappedTextLayoutCache)
+        g.WrappedTextLayoutCache.GarbageCollect(g.FrameCount);
+    else if (!g.WrappedTextLayoutCache.Layouts.empty())
+        g.WrappedTextLayoutCache.Clear();
+
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
     g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx] = g.IO.DeltaTime;
@@ -4550,12 +5430,15 @@ void ImGui::NewFrame()
     // Create implicit/fallback window - which we will only render it if the user has added something to it.
     // We don't use "Debug" to avoid colliding with user trying to create a "Debug" window with custom flags.
     // This fallback is particularly important as it avoid ImGui:: calls from crashing.
+    // (it stays open until EndFrame() so it is not timed by the profiler)
+    IMGUI_PROFILER_ZONE_END();
     g.WithinFrameScopeWithImplicitWindow = true;
     SetNextWindowSize(ImVec2(400, 400), ImGuiCond_FirstUseEver);
     Begin("Debug##Default");
     IM_ASSERT(g.CurrentWindow->IsFallbackWindow == true);
 
     CallContextHooks(&g, ImGuiContextHookType_NewFramePost);
+    g.FrameStatsCurrent.TimeNewFrame = FrameStatsEndPhase();
 }
 
 void ImGui::Initialize()
@@ -4616,6 +5499,8 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsSortBeginOrder.clear();
+    g.WindowsHoverGrid.Clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4644,6 +5529,8 @@ void ImGui::Shutdown()
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    g.TextSizeCache.Clear();
+    g.WrappedTextLayoutCache.Clear();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
@@ -4658,20 +5545,23 @@ void ImGui::Shutdown()
     }
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
+    g.DebugLogIndex.clear();
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerStopCapture();
+    g.Profiler.Clear();
+#endif
 
     g.Initialized = false;
 }
 
 // FIXME: Add a more explicit sort order in the window structure.
-static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
+static bool ChildWindowLess(ImGuiWindow* const& a, ImGuiWindow* const& b)
 {
-    const ImGuiWindow* const a = *(const ImGuiWindow* const *)lhs;
-    const ImGuiWindow* const b = *(const ImGuiWindow* const *)rhs;
     if (int d = (a->Flags & ImGuiWindowFlags_Popup) - (b->Flags & ImGuiWindowFlags_Popup))
-        return d;
+        return d < 0;
     if (int d = (a->Flags & ImGuiWindowFlags_Tooltip) - (b->Flags & ImGuiWindowFlags_Tooltip))
-        return d;
-    return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
+        return d < 0;
+    return a->BeginOrderWithinParent < b->BeginOrderWithinParent;
 }
 
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
@@ -4680,7 +5570,21 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
     if (window->Active)
     {
         int count = window->DC.ChildWindows.Size;
-        ImQsort(window->DC.ChildWindows.Data, (size_t)count, sizeof(ImGuiWindow*), ChildWindowComparer);
+        ImGuiWindow** child_windows = window->DC.ChildWindows.Data;
+#ifdef IMGUI_DEBUG_PARANOID
+        ImVector<ImGuiWindow*> child_windows_sorted = window->DC.ChildWindows;
+        ImSort<ImGuiWindow*, ChildWindowLess>(child_windows_sorted.Data, count);
+#endif
+        // Child windows are appended in Begin() order so they are usually already sorted: only sort when needed (e.g. child popups, tooltips)
+        for (int i = 1; i < count; i++)
+            if (ChildWindowLess(child_windows[i], child_windows[i - 1]))
+            {
+                ImSort<ImGuiWindow*, ChildWindowLess>(child_windows, count);
+                break;
+            }
+#ifdef IMGUI_DEBUG_PARANOID
+        IM_ASSERT(memcmp(child_windows, child_windows_sorted.Data, (size_t)count * sizeof(ImGuiWindow*)) == 0);
+#endif
         for (int i = 0; i < count; i++)
         {
             ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4900,6 +5804,8 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    IMGUI_PROFILER_ZONE_BEGIN("EndFrame");
+    g.FrameStatsCurrent.TimeUser = FrameStatsEndPhase();
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -4913,6 +5819,8 @@ void ImGui::EndFrame()
     g.WithinFrameScopeWithImplicitWindow = false;
     if (g.CurrentWindow && !g.CurrentWindow->WriteAccessed)
         g.CurrentWindow->Active = false;
+    if (g.CurrentWindow && g.CurrentWindow->Active != g.CurrentWindow->WasActive)
+        g.WindowsSortDirty = true; // Not tracked by Begin()
     End();
 
     // Update navigation: CTRL+Tab, wrap-around requests
@@ -4944,20 +5852,36 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
-    for (int i = 0; i != g.Windows.Size; i++)
+    // The result only depends on the previous display order, submission order and hierarchy: skip sorting when none of them changed since the last sort.
+    if (g.WindowsSortBeginOrder.Size != g.WindowsActiveCount)
     {
-        ImGuiWindow* window = g.Windows[i];
-        if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
-            continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        g.WindowsSortBeginOrder.resize(g.WindowsActiveCount);
+        g.WindowsSortDirty = true;
     }
+    bool sort_windows = g.WindowsSortDirty;
+#ifdef IMGUI_DEBUG_PARANOID
+    sort_windows = true; // Always sort, and verify that skipping would have been correct
+#endif
+    if (sort_windows)
+    {
+        g.WindowsTempSortBuffer.resize(0);
+        g.WindowsTempSortBuffer.reserve(g.Windows.Size);
+        for (int i = 0; i != g.Windows.Size; i++)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
+                continue;
+            AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        }
 
-    // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+        // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
+        IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
+        IM_ASSERT_PARANOID(g.WindowsSortDirty || memcmp(g.Windows.Data, g.WindowsTempSortBuffer.Data, (size_t)g.Windows.size_in_bytes()) == 0);
+        g.Windows.swap(g.WindowsTempSortBuffer);
+        g.WindowsSortDirty = false;
+    }
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
+    UpdateWindowsHoverGrid();
 
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
@@ -4967,6 +5891,9 @@ void ImGui::EndFrame()
     g.IO.InputQueueCharacters.resize(0);
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
+    g.FrameStatsCurrent.TimeEndFrame = FrameStatsEndPhase();
+    g.FrameStats = g.FrameStatsCurrent;
+    IMGUI_PROFILER_ZONE_END();
 }
 
 // Prepare the data for rendering so you can call GetDrawData()
@@ -4979,6 +5906,9 @@ void ImGui::Render()
 
     if (g.FrameCountEnded != g.FrameCount)
         EndFrame();
+    IMGUI_PROFILER_ZONE_BEGIN("Render");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawLists);
+    g.FrameStatsPhaseTicks = ImTimeGetTicks();
     const bool first_render_of_frame = (g.FrameCountRendered != g.FrameCount);
     g.FrameCountRendered = g.FrameCount;
     g.IO.MetricsRenderWindows = 0;
@@ -5019,6 +5949,8 @@ void ImGui::Render()
 
     // Setup ImDrawData structures for end-user
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    ImGuiFrameStats& stats = g.FrameStatsCurrent;
+    stats.DrawLists = stats.DrawCalls = stats.DrawListBytes = 0;
     for (int n = 0; n < g.Viewports.Size; n++)
     {
         ImGuiViewportP* viewport = g.Viewports[n];
@@ -5032,9 +5964,19 @@ void ImGui::Render()
         ImDrawData* draw_data = &viewport->DrawDataP;
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
+        for (int draw_list_n = 0; draw_list_n < draw_data->CmdListsCount; draw_list_n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[draw_list_n];
+            stats.DrawCalls += draw_list->CmdBuffer.Size;
+            stats.DrawListBytes += draw_list->CmdBuffer.size_in_bytes() + draw_list->VtxBuffer.size_in_bytes() + draw_list->IdxBuffer.size_in_bytes();
+        }
+        stats.DrawLists += draw_data->CmdListsCount;
     }
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
+    stats.TimeRender = FrameStatsEndPhase();
+    g.FrameStats = stats;
+    IMGUI_PROFILER_ZONE_END();
 }
 
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
@@ -5042,6 +5984,7 @@ void ImGui::Render()
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
 {
     ImGuiContext& g = *GImGui;
+    g.FrameStatsCurrent.CalcTextSizeCalls++;
 
     const char* text_display_end;
     if (hide_text_after_double_hash)
@@ -5049,20 +5992,362 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     else
         text_display_end = text_end;
 
-    ImFont* font = g.Font;
-    const float font_size = g.FontSize;
-    if (text == text_display_end)
-        return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    if (text == text_display_end)
+        return ImVec2(0.0f, font_size);
+    if (text_display_end == NULL)
+        text_display_end = text + strlen(text);
+
+    // Long word-wrapped text: use layout cache, which also stores the size
+    if (wrap_width > 0.0f)
+        if (ImGuiWrappedTextLayout* layout = GetWrappedTextLayout(text, text_display_end, wrap_width))
+            return layout->Size;
+
+    // Lookup in cache (optional)
+    ImGuiTextSizeCacheEntry* cache_entry = NULL;
+    if (g.IO.ConfigTextSizeCache)
+    {
+        bool cache_hit;
+        cache_entry = g.TextSizeCache.GetEntry(text, text_display_end, font, font_size, wrap_width, g.FrameCount, &cache_hit);
+        if (cache_hit)
+            return cache_entry->Size;
+    }
+
+    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+
+    // Round
+    // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
+    // FIXME: Investigate using ceilf or e.g.
+    // - https://git.musl-libc.org/cgit/musl/tree/src/math/ceilf.c
+    // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
+    text_size.x = IM_FLOOR(text_size.x + 0.99999f);
+
+    if (cache_entry)
+        cache_entry->Size = text_size;
+    return text_size;
+}
+
+// Cheap 64-bit hash processing 8 bytes per step, used by text caches. ImHashData() is byte-oriented and would cost more than measuring the text again.
+static ImU64 ImHashText64(const char* text, size_t len, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    ImU64 h = seed ^ ((ImU64)len * k);
+    for (; len >= 8; text += 8, len -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, text, 8);
+        h = (h ^ v) * k;
+        h ^= h >> 32;
+    }
+    if (len > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, text, len);
+        h = (h ^ v) * k;
+        h ^= h >> 32;
+    }
+    h ^= h >> 29;
+    h *= k;
+    h ^= h >> 32;
+    return h;
+}
+
+// Return entry matching given parameters, or recycle the least recently used entry of its set (in which case caller needs to fill entry->Size).
+ImGuiTextSizeCacheEntry* ImGuiTextSizeCache::GetEntry(const char* text, const char* text_end, ImFont* font, float font_size, float wrap_width, int frame_count, bool* out_hit)
+{
+    IM_STATIC_ASSERT((IMGUI_TEXT_SIZE_CACHE_SIZE & (IMGUI_TEXT_SIZE_CACHE_SIZE - 1)) == 0 && IMGUI_TEXT_SIZE_CACHE_SIZE >= 2);
+    if (Entries.empty())
+    {
+        Entries.resize(IMGUI_TEXT_SIZE_CACHE_SIZE);
+        memset(Entries.Data, 0, (size_t)Entries.size_in_bytes());
+    }
+    const int font_atlas_build_id = font->ContainerAtlas ? font->ContainerAtlas->BuildId : 0;
+
+    const int text_len = (int)(text_end - text);
+    ImU32 font_size_bits, wrap_width_bits;
+    memcpy(&font_size_bits, &font_size, sizeof(ImU32));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(ImU32));
+    const ImU64 seed = (ImU64)(size_t)font ^ ((ImU64)font_size_bits << 32) ^ wrap_width_bits;
+    const ImU64 hash = ImHashText64(text, (size_t)text_len, seed);
+
+    ImGuiTextSizeCacheEntry* set = &Entries.Data[(size_t)(hash & (IMGUI_TEXT_SIZE_CACHE_SIZE / 2 - 1)) * 2];
+    for (int n = 0; n < 2; n++)
+    {
+        ImGuiTextSizeCacheEntry* entry = &set[n];
+        if (entry->Hash == hash && entry->Text.Size == text_len && entry->Font == font && entry->FontAtlasBuildId == font_atlas_build_id && entry->FontSize == font_size && entry->WrapWidth == wrap_width && (text_len == 0 || memcmp(entry->Text.Data, text, (size_t)text_len) == 0))
+        {
+            entry->LastFrameUsed = frame_count;
+            HitsThisFrame++;
+            *out_hit = true;
+            return entry;
+        }
+    }
+
+    ImGuiTextSizeCacheEntry* entry = (set[0].LastFrameUsed <= set[1].LastFrameUsed) ? &set[0] : &set[1];
+    entry->Hash = hash;
+    entry->Text.resize(text_len);
+    if (text_len > 0)
+        memcpy(entry->Text.Data, text, (size_t)text_len);
+    entry->Font = font;
+    entry->FontAtlasBuildId = font_atlas_build_id;
+    entry->FontSize = font_size;
+    entry->WrapWidth = wrap_width;
+    entry->LastFrameUsed = frame_count;
+    MissesThisFrame++;
+    *out_hit = false;
+    return entry;
+}
+
+// Calculate begin and end offsets of each line of word-wrapped text, following the same logic as ImFont::RenderText(). Keep in sync!
+// ImFont::CalcWordWrapPositionA() is always called at the start of a line there, so line breaks only depend on the text and wrap width.
+static void CalcWordWrapLineOffsets(ImFont* font, float font_size, const char* text, const char* text_end, float wrap_width, ImVector<int>* out_offsets)
+{
+    const float scale = font_size / font->FontSize;
+    const char* word_wrap_eol = NULL;
+    const char* line_begin = text;
+    const char* s = text;
+    out_offsets->resize(0);
+    while (s < text_end)
+    {
+        if (!word_wrap_eol)
+        {
+            word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width);
+            if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character.
+                word_wrap_eol++;
+        }
+
+        if (s >= word_wrap_eol)
+        {
+            out_offsets->push_back((int)(line_begin - text));
+            out_offsets->push_back((int)(s - text));
+            word_wrap_eol = NULL;
+
+            // Wrapping skips upcoming blanks
+            while (s < text_end)
+            {
+                const char c = *s;
+                if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+            }
+            line_begin = s;
+            continue;
+        }
+
+        // Advance to end of line, either on a carriage return or on the wrapping point
+        const char* eol = ImMin(word_wrap_eol, text_end);
+        if (const char* new_line = (const char*)memchr(s, '\n', (size_t)(eol - s)))
+        {
+            out_offsets->push_back((int)(line_begin - text));
+            out_offsets->push_back((int)(new_line - text));
+            s = line_begin = new_line + 1;
+            continue;
+        }
+        while (s < word_wrap_eol) // Same as ImFont::RenderText() stepping one character at a time, which matters when we forced displaying a multi-byte character.
+        {
+            unsigned int c = (unsigned int)*s;
+            s += (c < 0x80) ? 1 : ImTextCharFromUtf8(&c, s, text_end);
+        }
+    }
+    out_offsets->push_back((int)(line_begin - text));
+    out_offsets->push_back((int)(text_end - text));
+}
+
+void ImGuiWrappedTextLayoutCache::Clear()
+{
+    for (int n = 0; n < Layouts.Size; n++)
+        IM_DELETE(Layouts[n]);
+    Layouts.clear();
+    Map.Clear();
+}
+
+void ImGuiWrappedTextLayoutCache::GarbageCollect(int frame_count)
+{
+    bool removed = false;
+    for (int n = 0; n < Layouts.Size; n++)
+        if (Layouts[n]->LastFrameUsed < frame_count - IMGUI_WRAPPED_TEXT_LAYOUT_MAX_AGE)
+        {
+            IM_DELETE(Layouts[n]);
+            Layouts[n] = Layouts.back();
+            Layouts.pop_back();
+            n--;
+            removed = true;
+        }
+    if (!removed)
+        return;
+    Map.Clear();
+    for (int n = 0; n < Layouts.Size; n++)
+        Map.SetInt((ImGuiID)Layouts[n]->Hash, n);
+}
+
+// Return layout matching given parameters, laying out text if not found or stale.
+ImGuiWrappedTextLayout* ImGuiWrappedTextLayoutCache::GetLayout(const char* text, const char* text_end, ImFont* font, float font_size, float wrap_width, int frame_count)
+{
+    const int font_atlas_build_id = font->ContainerAtlas ? font->ContainerAtlas->BuildId : 0;
+    const int text_len = (int)(text_end - text);
+    ImU32 font_size_bits, wrap_width_bits;
+    memcpy(&font_size_bits, &font_size, sizeof(ImU32));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(ImU32));
+    const ImU64 seed = (ImU64)(size_t)font ^ ((ImU64)font_size_bits << 32) ^ wrap_width_bits;
+    const ImU64 hash = ImHashText64(text, (size_t)text_len, seed);
+
+    // Lookup using lower 32-bits of the hash, then compare the full key: 64-bit hash, text contents, font, font size and wrap width.
+    // Layouts whose map key collide are found with a linear search (only the first one added is in the map).
+    ImGuiWrappedTextLayout* layout = NULL;
+    const int idx = Map.GetInt((ImGuiID)hash, -1);
+    if (idx != -1 && Layouts[idx]->MatchesKey(hash, text, text_len, font, font_size, wrap_width))
+        layout = Layouts[idx];
+    else if (idx != -1)
+        for (int n = 0; n < Layouts.Size && layout == NULL; n++)
+            if (Layouts[n]->MatchesKey(hash, text, text_len, font, font_size, wrap_width))
+                layout = Layouts[n];
+    if (layout != NULL && layout->FontAtlasBuildId == font_atlas_build_id)
+    {
+        layout->LastFrameUsed = frame_count;
+        return layout;
+    }
+    if (layout == NULL)
+    {
+        layout = IM_NEW(ImGuiWrappedTextLayout)();
+        if (idx == -1)
+            Map.SetInt((ImGuiID)hash, Layouts.Size);
+        Layouts.push_back(layout);
+        layout->Hash = hash;
+        layout->Text.resize(text_len);
+        memcpy(layout->Text.Data, text, (size_t)text_len);
+        layout->Font = font;
+        layout->FontSize = font_size;
+        layout->WrapWidth = wrap_width;
+    }
+
+    // Lay out new text, or text of a font which was rebuilt since
+    layout->FontAtlasBuildId = font_atlas_build_id;
+    layout->LastFrameUsed = frame_count;
+    layout->Size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_end, NULL);
+    layout->Size.x = IM_FLOOR(layout->Size.x + 0.99999f); // Round like CalcTextSize()
+    CalcWordWrapLineOffsets(font, font_size, text, text_end, wrap_width, &layout->LineOffsets);
+    return layout;
+}
+
+ImGuiWrappedTextLayout* ImGui::GetWrappedTextLayout(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(text_end != NULL && wrap_width > 0.0f);
+    if (!g.IO.ConfigWrappedTextLayoutCache || text_end - text < IMGUI_WRAPPED_TEXT_LAYOUT_MIN_LENGTH)
+        return NULL;
+    return g.WrappedTextLayoutCache.GetLayout(text, text_end, g.Font, g.FontSize, wrap_width, g.FrameCount);
+}
+
+// Return false if the window can't be hovered, otherwise the rectangle where it can be hovered.
+static bool GetWindowHoverRect(ImGuiWindow* window, const ImVec2& padding_regular, const ImVec2& padding_for_resize, ImRect* out_rect)
+{
+    if (!window->Active || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImRect bb(window->OuterRectClipped);
+    if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+        bb.Expand(padding_regular);
+    else
+        bb.Expand(padding_for_resize);
+    *out_rect = bb;
+    return bb.Min.x < bb.Max.x && bb.Min.y < bb.Max.y;
+}
+
+// Update the uniform grid used by FindHoveredWindow() when there are many windows (e.g. a node editor using one child window per node).
+// Called at the end of EndFrame() once windows are sorted in display order. Only rebuilt when display order, rectangles or visibility changed.
+static void UpdateWindowsHoverGrid()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHoverGrid& grid = g.WindowsHoverGrid;
+    if (g.Windows.Size < WINDOWS_HOVER_GRID_MIN_COUNT)
+    {
+        if (grid.Windows.Size > 0)
+            grid.Clear();
+        return;
+    }
+
+    // Compute hoverable rectangles, and compare with the ones used to build the grid
+    const ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    const ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
+    bool dirty = grid.Windows.Size != g.Windows.Size || memcmp(grid.Windows.Data, g.Windows.Data, (size_t)g.Windows.Size * sizeof(ImGuiWindow*)) != 0;
+    dirty |= memcmp(&grid.PaddingRegular, &padding_regular, sizeof(ImVec2)) != 0 || memcmp(&grid.PaddingForResize, &padding_for_resize, sizeof(ImVec2)) != 0;
+    grid.Rects.resize(g.Windows.Size);
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    int hoverable_count = 0;
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImRect bb;
+        if (GetWindowHoverRect(g.Windows[i], padding_regular, padding_for_resize, &bb))
+        {
+            bounds.Add(bb);
+            hoverable_count++;
+        }
+        else
+        {
+            bb = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        }
+        if (!dirty && memcmp(&bb, &grid.Rects[i], sizeof(ImRect)) != 0)
+            dirty = true;
+        grid.Rects[i] = bb;
+    }
+    if (!dirty)
+        return;
+
+    grid.Windows = g.Windows;
+    grid.PaddingRegular = padding_regular;
+    grid.PaddingForResize = padding_for_resize;
+    grid.CellsStart.resize(0);
+    grid.CellsWindows.resize(0);
+    grid.CellsX = grid.CellsY = 0;
+    if (hoverable_count == 0)
+        return;
 
-    // Round
-    // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
-    // FIXME: Investigate using ceilf or e.g.
-    // - https://git.musl-libc.org/cgit/musl/tree/src/math/ceilf.c
-    // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
-    text_size.x = IM_FLOOR(text_size.x + 0.99999f);
+    // Aim for about one cell per hoverable window
+    const float cell_size = ImMax(ImSqrt(bounds.GetWidth() * bounds.GetHeight() / (float)hoverable_count), 1.0f);
+    grid.CellsX = ImClamp((int)(bounds.GetWidth() / cell_size) + 1, 1, WINDOWS_HOVER_GRID_MAX_CELLS);
+    grid.CellsY = ImClamp((int)(bounds.GetHeight() / cell_size) + 1, 1, WINDOWS_HOVER_GRID_MAX_CELLS);
+    grid.Min = bounds.Min;
+    grid.InvCellSize = ImVec2((float)grid.CellsX / bounds.GetWidth(), (float)grid.CellsY / bounds.GetHeight());
 
-    return text_size;
+    // Count windows per cell, then store them (in display order) at their cell offset
+    const int cells_count = grid.CellsX * grid.CellsY;
+    grid.CellsStart.resize(cells_count + 1);
+    memset(grid.CellsStart.Data, 0, (size_t)grid.CellsStart.size_in_bytes());
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int i = 0; i < grid.Rects.Size; i++)
+        {
+            const ImRect& bb = grid.Rects[i];
+            if (bb.Min.x > bb.Max.x)
+                continue;
+            const int x0 = ImClamp((int)((bb.Min.x - grid.Min.x) * grid.InvCellSize.x), 0, grid.CellsX - 1);
+            const int x1 = ImClamp((int)((bb.Max.x - grid.Min.x) * grid.InvCellSize.x), 0, grid.CellsX - 1);
+            const int y0 = ImClamp((int)((bb.Min.y - grid.Min.y) * grid.InvCellSize.y), 0, grid.CellsY - 1);
+            const int y1 = ImClamp((int)((bb.Max.y - grid.Min.y) * grid.InvCellSize.y), 0, grid.CellsY - 1);
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                {
+                    const int cell_n = y * grid.CellsX + x;
+                    if (pass == 0)
+                        grid.CellsStart[cell_n + 1]++;
+                    else
+                        grid.CellsWindows[grid.CellsStart[cell_n]++] = i; // Use CellsStart[] as write cursor
+                }
+        }
+        if (pass == 0)
+        {
+            for (int cell_n = 0; cell_n < cells_count; cell_n++)
+                grid.CellsStart[cell_n + 1] += grid.CellsStart[cell_n];
+            grid.CellsWindows.resize(grid.CellsStart[cells_count]);
+        }
+    }
+
+    // Write cursors ended on the start of the next cell
+    for (int cell_n = cells_count; cell_n > 0; cell_n--)
+        grid.CellsStart[cell_n] = grid.CellsStart[cell_n - 1];
+    grid.CellsStart[0] = 0;
 }
 
 // Find window given position, search front-to-back
@@ -5080,22 +6365,39 @@ static void FindHoveredWindow()
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+
+    // When there are many windows, only test the ones overlapping the grid cell under the mouse (see UpdateWindowsHoverGrid())
+    // The grid is built at the end of the previous frame: fallback to testing all windows if the display order changed since then.
+    ImGuiWindowHoverGrid& grid = g.WindowsHoverGrid;
+    const int* grid_windows = NULL;
+    int candidates_count = g.Windows.Size;
+    if (grid.Windows.Size == g.Windows.Size && memcmp(&grid.PaddingRegular, &padding_regular, sizeof(ImVec2)) == 0 && memcmp(&grid.PaddingForResize, &padding_for_resize, sizeof(ImVec2)) == 0)
+    {
+        static const int empty_cell = 0;
+        grid_windows = &empty_cell;
+        candidates_count = 0;
+        const ImVec2 mouse_cell = (g.IO.MousePos - grid.Min) * grid.InvCellSize;
+        if (mouse_cell.x >= 0.0f && mouse_cell.y >= 0.0f && mouse_cell.x < (float)grid.CellsX && mouse_cell.y < (float)grid.CellsY)
+        {
+            const int cell_n = (int)mouse_cell.y * grid.CellsX + (int)mouse_cell.x;
+            grid_windows = grid.CellsWindows.Data + grid.CellsStart[cell_n];
+            candidates_count = grid.CellsStart[cell_n + 1] - grid.CellsStart[cell_n];
+        }
+        for (int n = 0; n < candidates_count; n++)
+            if (g.Windows[grid_windows[n]] != grid.Windows[grid_windows[n]])
+            {
+                grid_windows = NULL;
+                candidates_count = g.Windows.Size;
+                break;
+            }
+    }
+
+    for (int n = candidates_count - 1; n >= 0; n--)
     {
-        ImGuiWindow* window = g.Windows[i];
+        ImGuiWindow* window = g.Windows[grid_windows ? grid_windows[n] : n];
         IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize);
-        if (!bb.Contains(g.IO.MousePos))
+        ImRect bb;
+        if (!GetWindowHoverRect(window, padding_regular, padding_for_resize, &bb) || !bb.Contains(g.IO.MousePos))
             continue;
 
         // Support for one rectangular hole in any given window
@@ -5449,6 +6751,8 @@ static void UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_created,
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
+
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
     // Create window the first time
@@ -5489,6 +6793,7 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    g.WindowsSortDirty = true;
 
     return window;
 }
@@ -6091,6 +7396,7 @@ static ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
@@ -6112,6 +7418,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const int current_frame = g.FrameCount;
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILER_ZONE_BEGIN_WINDOW(window);
 
     // Update the Appearing flag
     bool window_just_activated_by_user = (window->LastFrameActive < current_frame - 1);   // Not using !WasActive because the implicit "Debug" window would always toggle off->on
@@ -6129,11 +7437,22 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (first_begin_of_the_frame)
     {
         UpdateWindowInFocusOrderList(window, window_just_created, flags);
+        if ((window->Flags ^ flags) & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip))
+            g.WindowsSortDirty = true;
         window->Flags = (ImGuiWindowFlags)flags;
         window->LastFrameActive = current_frame;
         window->LastTimeActive = (float)g.Time;
         window->BeginOrderWithinParent = 0;
         window->BeginOrderWithinContext = (short)(g.WindowsActiveCount++);
+
+        // Track changes of submission order, so EndFrame() can skip sorting windows when they were submitted like during the last sort
+        if (window->BeginOrderWithinContext == g.WindowsSortBeginOrder.Size)
+            g.WindowsSortBeginOrder.push_back(NULL);
+        if (g.WindowsSortBeginOrder[window->BeginOrderWithinContext] != window)
+        {
+            g.WindowsSortBeginOrder[window->BeginOrderWithinContext] = window;
+            g.WindowsSortDirty = true;
+        }
     }
     else
     {
@@ -6173,6 +7492,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     // Update ->RootWindow and others pointers (before any possible call to FocusWindow)
     if (first_begin_of_the_frame)
     {
+        if (window->ParentWindow != parent_window)
+            g.WindowsSortDirty = true;
         UpdateWindowParentAndRootLinks(window, flags, parent_window);
         window->ParentWindowInBeginStack = parent_window_in_stack;
     }
@@ -6756,6 +8077,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 void ImGui::End()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = g.CurrentWindow;
 
     // Error checking: verify that user hasn't called End() too many times!
@@ -6788,6 +8110,8 @@ void ImGui::End()
     g.CurrentWindowStack.back().StackSizesOnBegin.CompareWithCurrentState();
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILER_ZONE_END();
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -6822,6 +8146,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
         {
             memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
             g.Windows[g.Windows.Size - 1] = window;
+            g.WindowsSortDirty = true;
             break;
         }
 }
@@ -6836,6 +8161,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
         {
             memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
             g.Windows[0] = window;
+            g.WindowsSortDirty = true;
             break;
         }
 }
@@ -6860,6 +8186,7 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
         memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
         g.Windows[pos_beh] = window;
     }
+    g.WindowsSortDirty = true;
 }
 
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
@@ -7561,6 +8888,14 @@ void ImGui::PushID(int int_id)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(const ImGuiLabelLiteral& str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = window->GetID(str_id);
+    window->IDStack.push_back(id);
+}
+
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiID id)
 {
@@ -7576,8 +8911,9 @@ void ImGui::PushOverrideID(ImGuiID id)
 //  for that to work we would need to do PushOverrideID() -> ItemAdd() -> PopID() which would alter widget code a little more)
 ImGuiID ImGui::GetIDWithSeed(const char* str, const char* str_end, ImGuiID seed)
 {
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
+    ImGuiID id = (str == str_end) ? ImHashData(str, 0, seed) : ImHashStr(str, str_end ? (str_end - str) : 0, seed);
     ImGuiContext& g = *GImGui;
+    g.FrameStatsCurrent.IdHashCalls++;
     if (g.DebugHookIdInfo == id)
         DebugHookIdInfo(id, ImGuiDataType_String, str, str_end);
     return id;
@@ -7608,6 +8944,12 @@ ImGuiID ImGui::GetID(const void* ptr_id)
     return window->GetID(ptr_id);
 }
 
+ImGuiID ImGui::GetID(const ImGuiLabelLiteral& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
 bool ImGui::IsRectVisible(const ImVec2& size)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -7993,6 +9335,7 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_SCOPE("UpdateInputEvents");
 
     // Only trickle chars<>key when working with InputText()
     // FIXME: InputText() could parse event trail?
@@ -8180,6 +9523,7 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    IM_ASSERT((!(g.IO.Fonts->Flags & ImFontAtlasFlags_SignedDistanceField) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts)) && "Font Atlas was built with ImFontAtlasFlags_SignedDistanceField but renderer backend doesn't support it!");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -8453,6 +9797,7 @@ bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg, ImGu
     g.LastItemData.NavRect = nav_bb_arg ? *nav_bb_arg : bb;
     g.LastItemData.InFlags = g.CurrentItemFlags | extra_flags;
     g.LastItemData.StatusFlags = ImGuiItemStatusFlags_None;
+    g.FrameStatsCurrent.ItemsSubmitted++;
 
     // Directional navigation processing
     if (id != 0)
@@ -8498,7 +9843,10 @@ bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg, ImGu
     // Clipping test
     const bool is_clipped = IsClippedEx(bb, id);
     if (is_clipped)
+    {
+        g.FrameStatsCurrent.ItemsClipped++;
         return false;
+    }
     //if (g.IO.KeyAlt) window->DrawList->AddRect(bb.Min, bb.Max, IM_COL32(255,255,0,120)); // [DEBUG]
 
     // We need to calculate this now to take account of the current clipping rectangle (as items like Selectable may change them)
@@ -10273,6 +11621,7 @@ static void ImGui::NavUpdate()
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_SCOPE("NavUpdate");
 
     io.WantSetMousePos = false;
     //if (g.NavScoringDebugCount > 0) IMGUI_DEBUG_LOG_NAV("[nav] NavScoringDebugCount %d for '%s' layer %d (Init:%d, Move:%d)\n", g.NavScoringDebugCount, g.NavWindow ? g.NavWindow->Name : "NULL", g.NavLayer, g.NavInitRequest || g.NavInitResultId != 0, g.NavMoveRequest);
@@ -11468,6 +12817,7 @@ void ImGui::EndDragDropTarget()
 // Pass text data straight to log (without being displayed)
 static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Logging);
     if (g.LogFile)
     {
         g.LogBuffer.Buf.resize(0);
@@ -11507,6 +12857,7 @@ void ImGui::LogTextV(const char* fmt, va_list args)
 void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char* text_end)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Logging);
     ImGuiWindow* window = g.CurrentWindow;
 
     const char* prefix = g.LogNextPrefix;
@@ -11566,6 +12917,7 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
 void ImGui::LogBegin(ImGuiLogType type, int auto_open_depth)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Logging);
     ImGuiWindow* window = g.CurrentWindow;
     IM_ASSERT(g.LogEnabled == false);
     IM_ASSERT(g.LogFile == NULL);
@@ -11768,6 +13120,7 @@ void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
 
 #if !IMGUI_DEBUG_INI_SETTINGS
     // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
@@ -11838,6 +13191,7 @@ void ImGui::ClearIniSettings()
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     size_t file_data_size = 0;
     char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
     if (!file_data)
@@ -11851,6 +13205,7 @@ void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     IM_ASSERT(g.Initialized);
     //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
     //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
@@ -11938,7 +13293,9 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     g.SettingsDirtyTimer = 0.0f;
+    g.FrameStatsCurrent.SettingsWrites++;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
@@ -12254,6 +13611,281 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerNewFrame() [Internal]
+// - ProfilerZoneBegin() [Internal]
+// - ProfilerZoneEnd() [Internal]
+// - ProfilerTraceAppendFrame() [Internal]
+// - ProfilerExportTrace() [Internal]
+// - ProfilerStartCapture() [Internal]
+// - ProfilerStopCapture() [Internal]
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+ImGuiProfilerFrame* ImGuiProfiler::GetCompletedFrame(int n)
+{
+    if (n < 0 || n >= IMGUI_PROFILER_FRAMES_COUNT - (Recording ? 1 : 0))
+        return NULL;
+    int frame_idx = FrameIdx - n - (Recording ? 1 : 0);
+    if (frame_idx < 0)
+        frame_idx += IMGUI_PROFILER_FRAMES_COUNT;
+    ImGuiProfilerFrame* frame = &Frames[frame_idx];
+    return (frame->FrameCount >= 0 && frame->TicksEnd != 0) ? frame : NULL;
+}
+
+static void ProfilerTraceAppendFrame(ImGuiTextBuffer* buf, const ImGuiProfiler* profiler, const ImGuiProfilerFrame* frame, ImU64* ticks_base);
+static bool ProfilerCaptureFlush(ImGuiProfiler* profiler);
+
+ImGuiProfilerScope::ImGuiProfilerScope(const char* name)   { ImGui::ProfilerZoneBegin(name); }
+ImGuiProfilerScope::~ImGuiProfilerScope()                   { ImGui::ProfilerZoneEnd(); }
+
+// Called at the beginning of NewFrame(): complete the previous frame and start recording in the next slot of the ring buffer.
+void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    const ImU64 ticks = ImTimeGetTicks();
+    if (profiler.TicksPerSecond == 0)
+        profiler.TicksPerSecond = ImTimeGetTicksPerSecond();
+
+    if (profiler.Recording)
+    {
+        // Close zones left open (e.g. a zone spanning NewFrame())
+        ImGuiProfilerFrame& prev_frame = profiler.Frames[profiler.FrameIdx];
+        IM_ASSERT(profiler.ZonesStack.Size == 0 && "Profiler zones cannot span a call to NewFrame()!");
+        while (profiler.ZonesStack.Size > 0)
+        {
+            prev_frame.Zones[profiler.ZonesStack.back()].TicksEnd = ticks;
+            profiler.ZonesStack.pop_back();
+        }
+        prev_frame.TicksEnd = ticks;
+        profiler.Recording = false;
+
+        // Stream completed frame to the capture file, writing it in large blocks
+        if (profiler.CaptureFile != NULL)
+        {
+            ProfilerTraceAppendFrame(&profiler.CaptureBuf, &profiler, &prev_frame, &profiler.CaptureTicksBase);
+            profiler.CaptureFramesCount++;
+            if (profiler.CaptureBuf.size() >= IMGUI_PROFILER_CAPTURE_BUFFER_SIZE)
+                ProfilerCaptureFlush(&profiler);
+        }
+    }
+    if (profiler.Paused && profiler.CaptureFile == NULL)
+        return;
+
+    profiler.FrameIdx = (profiler.FrameIdx + 1) % IMGUI_PROFILER_FRAMES_COUNT;
+    ImGuiProfilerFrame& frame = profiler.Frames[profiler.FrameIdx];
+    frame.FrameCount = g.FrameCount + 1; // NewFrame() has not incremented it yet
+    frame.TicksBegin = ticks;
+    frame.TicksEnd = 0;
+    frame.Zones.resize(0);
+    profiler.Recording = true;
+}
+
+void ImGui::ProfilerZoneBegin(const char* name, ImGuiID window_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    if (!profiler.Recording)
+        return;
+    ImVector<ImGuiProfilerZone>& zones = profiler.Frames[profiler.FrameIdx].Zones;
+    profiler.ZonesStack.push_back(zones.Size);
+    zones.resize(zones.Size + 1);
+    ImGuiProfilerZone& zone = zones.back();
+    zone.Name = name;
+    zone.WindowID = window_id;
+    zone.Depth = profiler.ZonesStack.Size - 1;
+    zone.TicksEnd = 0;
+    zone.TicksBegin = ImTimeGetTicks();
+}
+
+void ImGui::ProfilerZoneEnd()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    if (!profiler.Recording)
+        return;
+    const ImU64 ticks = ImTimeGetTicks();
+    IM_ASSERT(profiler.ZonesStack.Size > 0 && "Mismatched ProfilerZoneBegin()/ProfilerZoneEnd() calls!");
+    if (profiler.ZonesStack.Size == 0)
+        return;
+    profiler.Frames[profiler.FrameIdx].Zones[profiler.ZonesStack.back()].TicksEnd = ticks;
+    profiler.ZonesStack.pop_back();
+}
+
+// Chrome Trace Event Format: a JSON array of events. We only output complete events ("ph":"X"), with timestamps in microseconds.
+// Events are written without vsnprintf() as a long capture outputs hundreds of events per frame.
+static char* ProfilerTraceWriteStr(char* p, const char* str)
+{
+    const size_t len = strlen(str);
+    memcpy(p, str, len);
+    return p + len;
+}
+
+static char* ProfilerTraceWriteMicroseconds(char* p, ImU64 ns)
+{
+    char digits[24];
+    int digits_count = 0;
+    ImU64 us = ns / 1000;
+    do { digits[digits_count++] = (char)('0' + (int)(us % 10)); us /= 10; } while (us > 0);
+    while (digits_count > 0)
+        *p++ = digits[--digits_count];
+    const int frac = (int)(ns % 1000);
+    *p++ = '.';
+    *p++ = (char)('0' + frac / 100);
+    *p++ = (char)('0' + (frac / 10) % 10);
+    *p++ = (char)('0' + frac % 10);
+    return p;
+}
+
+static void ProfilerTraceAppendEvent(ImGuiTextBuffer* buf, const char* name, const char* category, ImU64 ns_begin, ImU64 ns_duration)
+{
+    // Format in a local buffer to append it in one go. Long names are appended in several blocks.
+    char tmp[512];
+    char* p = tmp;
+    char* const p_flush = tmp + IM_ARRAYSIZE(tmp) - 160; // Leave room for the end of the event
+    p = ProfilerTraceWriteStr(p, "{\"name\":\"");
+    for (const char* s = name; *s; s++)
+    {
+        if (p >= p_flush)
+        {
+            buf->append(tmp, p);
+            p = tmp;
+        }
+        const unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\')
+        {
+            *p++ = '\\';
+            *p++ = (char)c;
+        }
+        else if (c < 0x20)
+        {
+            p += ImFormatString(p, 7, "\\u%04x", c);
+        }
+        else
+        {
+            *p++ = (char)c;
+        }
+    }
+    p = ProfilerTraceWriteStr(p, "\",\"cat\":\"");
+    p = ProfilerTraceWriteStr(p, category);
+    p = ProfilerTraceWriteStr(p, "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":");
+    p = ProfilerTraceWriteMicroseconds(p, ns_begin);
+    p = ProfilerTraceWriteStr(p, ",\"dur\":");
+    p = ProfilerTraceWriteMicroseconds(p, ns_duration);
+    p = ProfilerTraceWriteStr(p, "},\n");
+    buf->append(tmp, p);
+}
+
+// Append a frame and its zones. Timestamps are relative to *ticks_base, which is set from the first frame written.
+static void ProfilerTraceAppendFrame(ImGuiTextBuffer* buf, const ImGuiProfiler* profiler, const ImGuiProfilerFrame* frame, ImU64* ticks_base)
+{
+    if (*ticks_base == 0)
+        *ticks_base = frame->TicksBegin;
+    const double ns_per_tick = 1000000000.0 / (double)profiler->TicksPerSecond;
+    const ImU64 base = *ticks_base;
+
+    char frame_name[32];
+    ImFormatString(frame_name, IM_ARRAYSIZE(frame_name), "Frame %d", frame->FrameCount);
+    ProfilerTraceAppendEvent(buf, frame_name, "frame", (ImU64)((double)(frame->TicksBegin - base) * ns_per_tick), (ImU64)((double)(frame->TicksEnd - frame->TicksBegin) * ns_per_tick));
+    for (int n = 0; n < frame->Zones.Size; n++)
+    {
+        const ImGuiProfilerZone* zone = &frame->Zones[n];
+        ProfilerTraceAppendEvent(buf, zone->Name, zone->WindowID ? "window" : "zone", (ImU64)((double)(zone->TicksBegin - base) * ns_per_tick), (ImU64)((double)(zone->TicksEnd - zone->TicksBegin) * ns_per_tick));
+    }
+}
+
+static const char* ProfilerTraceHeader = "{\"traceEvents\":[\n";
+static const char* ProfilerTraceFooter = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Dear ImGui\"}}\n],\"displayTimeUnit\":\"ms\"}\n"; // Last event without a trailing comma
+
+// Write all completed frames currently held in the ring buffer (up to IMGUI_PROFILER_FRAMES_COUNT)
+bool ImGui::ProfilerExportTrace(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+
+    int frames_count = 0;
+    int events_count = 0;
+    while (ImGuiProfilerFrame* frame = profiler.GetCompletedFrame(frames_count))
+    {
+        events_count += 1 + frame->Zones.Size;
+        frames_count++;
+    }
+    ImGuiTextBuffer buf;
+    buf.reserve(events_count * 128 + 1024);
+    buf.append(ProfilerTraceHeader);
+    ImU64 ticks_base = 0;
+    for (int n = frames_count - 1; n >= 0; n--)
+        ProfilerTraceAppendFrame(&buf, &profiler, profiler.GetCompletedFrame(n), &ticks_base);
+    buf.append(ProfilerTraceFooter);
+    bool ret = ImFileWrite(buf.begin(), 1, (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ret &= ImFileClose(f); // May flush buffered output
+    return ret;
+}
+
+// Frames are written as they complete, in blocks of IMGUI_PROFILER_CAPTURE_BUFFER_SIZE bytes, so captures of any length only use a fixed amount of memory.
+bool ImGui::ProfilerStartCapture(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    ProfilerStopCapture();
+    profiler.CaptureFile = ImFileOpen(filename, "wb");
+    if (profiler.CaptureFile == NULL)
+        return false;
+    profiler.CaptureBuf.Buf.resize(0);
+    profiler.CaptureBuf.reserve(IMGUI_PROFILER_CAPTURE_BUFFER_SIZE + 4096);
+    profiler.CaptureBuf.append(ProfilerTraceHeader);
+    profiler.CaptureTicksBase = 0;
+    profiler.CaptureFramesCount = 0;
+    profiler.CaptureFailed = false;
+    profiler.Paused = false;
+    return true;
+}
+
+// Return false if the capture was already stopped by a write error, or if writing its end failed: the file is then incomplete.
+bool ImGui::ProfilerStopCapture()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    if (profiler.CaptureFile == NULL)
+        return !profiler.CaptureFailed;
+    profiler.CaptureBuf.append(ProfilerTraceFooter);
+    if (!ProfilerCaptureFlush(&profiler))
+        return false;
+    const bool ret = ImFileClose(profiler.CaptureFile); // May flush buffered output
+    if (!ret)
+        IMGUI_DEBUG_LOG("Profiler: error closing capture file, capture stopped after %d frames.\n", profiler.CaptureFramesCount);
+    profiler.CaptureFile = NULL;
+    profiler.CaptureBuf.clear();
+    profiler.CaptureFailed = !ret;
+    return ret;
+}
+
+// Write pending capture output. On error (e.g. disk full) the capture is stopped and CaptureFailed is set, rather than dropping output and silently producing an invalid file.
+static bool ProfilerCaptureFlush(ImGuiProfiler* profiler)
+{
+    const ImU64 size = (ImU64)profiler->CaptureBuf.size();
+    if (ImFileWrite(profiler->CaptureBuf.begin(), 1, size, profiler->CaptureFile) == size)
+    {
+        profiler->CaptureBuf.Buf.resize(0); // Keep capacity
+        return true;
+    }
+    IMGUI_DEBUG_LOG("Profiler: error writing capture file, capture stopped after %d frames.\n", profiler->CaptureFramesCount);
+    ImFileClose(profiler->CaptureFile);
+    profiler->CaptureFile = NULL;
+    profiler->CaptureBuf.clear();
+    profiler->CaptureFailed = true;
+    return false;
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -12268,6 +13900,8 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 // - DebugNodeDrawCmdShowMeshAndBoundingBox() [Internal]
 // - DebugNodeFont() [Internal]
 // - DebugNodeFontGlyph() [Internal]
+// - DebugNodeMemoryStats() [Internal]
+// - DebugNodeProfiler() [Internal]
 // - DebugNodeStorage() [Internal]
 // - DebugNodeTabBar() [Internal]
 // - DebugNodeViewport() [Internal]
@@ -12380,6 +14014,11 @@ static void MetricsHelpMarker(const char* desc)
     }
 }
 
+static bool WindowLessByBeginOrder(ImGuiWindow* const& a, ImGuiWindow* const& b)
+{
+    return a->BeginOrderWithinContext < b->BeginOrderWithinContext;
+}
+
 // [DEBUG] List fonts in a font atlas and display its texture
 void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
 {
@@ -12390,7 +14029,8 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         DebugNodeFont(font);
         PopID();
     }
-    if (TreeNode("Atlas texture", "Atlas texture (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
+    const float tex_occupancy = (atlas->TexWidth > 0 && atlas->TexHeight > 0) ? (float)atlas->TexPackedSurface / ((float)atlas->TexWidth * atlas->TexHeight) : 0.0f;
+    if (TreeNode("Atlas texture", "Atlas texture (%dx%d pixels, %.1f%% occupied)", atlas->TexWidth, atlas->TexHeight, tex_occupancy * 100.0f))
     {
         ImVec4 tint_col = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
         ImVec4 border_col = ImVec4(1.0f, 1.0f, 1.0f, 0.5f);
@@ -12568,6 +14208,38 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Frame statistics (see GetFrameStats())
+    if (TreeNode("Frame Statistics"))
+    {
+        const ImGuiFrameStats& stats = g.FrameStats;
+        Text("Frame %d", stats.FrameCount);
+        Text("Items: %d submitted, %d clipped", stats.ItemsSubmitted, stats.ItemsClipped);
+        Text("CalcTextSize(): %d calls, IDs hashed: %d, settings writes: %d", stats.CalcTextSizeCalls, stats.IdHashCalls, stats.SettingsWrites);
+        Text("Allocations: %d (%d bytes)", stats.Allocations, (int)stats.AllocatedBytes);
+        Text("Draw lists: %d, draw calls: %d (%d bytes)", stats.DrawLists, stats.DrawCalls, stats.DrawListBytes);
+        Text("Time: NewFrame %.3f ms, user %.3f ms, EndFrame %.3f ms, Render %.3f ms", stats.TimeNewFrame, stats.TimeUser, stats.TimeEndFrame, stats.TimeRender);
+        TreePop();
+    }
+
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    // Memory
+    if (TreeNode("Memory"))
+    {
+        ImGuiMemStats mem_stats = GetAllocatorStats();
+        DebugNodeMemoryStats(&mem_stats);
+        TreePop();
+    }
+#endif
+
+#ifdef IMGUI_ENABLE_PROFILER
+    // Profiler
+    if (TreeNode("Profiler"))
+    {
+        DebugNodeProfiler(&g.Profiler);
+        TreePop();
+    }
+#endif
+
     // Windows
     if (TreeNode("Windows", "Windows (%d)", g.Windows.Size))
     {
@@ -12582,8 +14254,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             for (int i = 0; i < g.Windows.Size; i++)
                 if (g.Windows[i]->LastFrameActive + 1 >= g.FrameCount)
                     temp_buffer.push_back(g.Windows[i]);
-            struct Func { static int IMGUI_CDECL WindowComparerByBeginOrder(const void* lhs, const void* rhs) { return ((int)(*(const ImGuiWindow* const *)lhs)->BeginOrderWithinContext - (*(const ImGuiWindow* const*)rhs)->BeginOrderWithinContext); } };
-            ImQsort(temp_buffer.Data, (size_t)temp_buffer.Size, sizeof(ImGuiWindow*), Func::WindowComparerByBeginOrder);
+            ImSort<ImGuiWindow*, WindowLessByBeginOrder>(temp_buffer.Data, temp_buffer.Size);
             DebugNodeWindowsListByBeginStackParent(temp_buffer.Data, temp_buffer.Size, NULL);
             TreePop();
         }
@@ -12661,6 +14332,42 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Details for CalcTextSize() cache
+    ImGuiTextSizeCache& text_size_cache = g.TextSizeCache;
+    if (TreeNode("TextSizeCache", "Text size cache (%s)", g.IO.ConfigTextSizeCache ? "enabled" : "disabled"))
+    {
+        Checkbox("io.ConfigTextSizeCache", &g.IO.ConfigTextSizeCache);
+        const int lookups = text_size_cache.HitsLastFrame + text_size_cache.MissesLastFrame;
+        Text("Last frame: %d lookups, %d hits, %d misses (%.1f%% hit rate)", lookups, text_size_cache.HitsLastFrame, text_size_cache.MissesLastFrame, lookups ? text_size_cache.HitsLastFrame * 100.0f / lookups : 0.0f);
+        int entries_used = 0, entries_recent = 0, text_bytes = 0;
+        for (int n = 0; n < text_size_cache.Entries.Size; n++)
+        {
+            if (text_size_cache.Entries[n].Font != NULL)
+            {
+                entries_used++;
+                entries_recent += (text_size_cache.Entries[n].LastFrameUsed >= g.FrameCount - 60) ? 1 : 0;
+            }
+            text_bytes += text_size_cache.Entries[n].Text.Capacity;
+        }
+        Text("Entries: %d/%d used, %d used in last 60 frames (%d bytes)", entries_used, text_size_cache.Entries.Size, entries_recent, text_size_cache.Entries.size_in_bytes() + text_bytes);
+        TreePop();
+    }
+
+    // Details for word-wrapped text layout cache
+    ImGuiWrappedTextLayoutCache& wrap_cache = g.WrappedTextLayoutCache;
+    if (TreeNode("WrappedTextLayoutCache", "Wrapped text layout cache (%d layouts)", wrap_cache.Layouts.Size))
+    {
+        Checkbox("io.ConfigWrappedTextLayoutCache", &g.IO.ConfigWrappedTextLayoutCache);
+        int lines_count = 0, bytes = 0;
+        for (int n = 0; n < wrap_cache.Layouts.Size; n++)
+        {
+            lines_count += wrap_cache.Layouts[n]->LineOffsets.Size / 2;
+            bytes += (int)sizeof(ImGuiWrappedTextLayout) + wrap_cache.Layouts[n]->Text.size_in_bytes() + wrap_cache.Layouts[n]->LineOffsets.size_in_bytes();
+        }
+        Text("%d layouts, %d lines (%d bytes)", wrap_cache.Layouts.Size, lines_count, bytes);
+        TreePop();
+    }
+
     // Details for InputText
     if (TreeNode("InputText"))
     {
@@ -12990,8 +14697,12 @@ void ImGui::DebugNodeFont(ImFont* font)
     char c_str[5];
     Text("Fallback character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->FallbackChar), font->FallbackChar);
     Text("Ellipsis character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->EllipsisChar), font->EllipsisChar);
+    Text("Monospace: %s", font->IsMonospace() ? "Yes" : "No");
+    if (font->IsMonospace()) { SameLine(); Text("(advance %.3f)", font->MonospaceAdvanceX); }
     const int surface_sqrt = (int)ImSqrt((float)font->MetricsTotalSurface);
     Text("Texture Area: about %d px ~%dx%d px", font->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+    Text("Lookup tables: U+0000..U+%04X dense, %d page(s) of 256 above (%d bytes)", ImMax(font->IndexLookup.Size - 1, 0), font->IndexPagesLookup.Size / 256,
+        font->IndexLookup.size_in_bytes() + font->IndexAdvanceX.size_in_bytes() + font->IndexPagesMap.size_in_bytes() + font->IndexPagesLookup.size_in_bytes() + font->IndexPagesAdvanceX.size_in_bytes());
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
@@ -13063,6 +14774,246 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
     Text("UV: (%.3f,%.3f)->(%.3f,%.3f)", glyph->U0, glyph->V0, glyph->U1, glyph->V1);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+// [DEBUG] Display allocation counters per tag
+void ImGui::DebugNodeMemoryStats(const ImGuiMemStats* stats)
+{
+    MetricsHelpMarker("Allocations are accounted to the innermost IMGUI_MEM_TAG_SCOPE() active when they are made.\nCounters are shared by all contexts and threads.\n'Last frame' counts allocations from one NewFrame() to the next: in a steady state it should be zero.");
+    if (!BeginTable("##MemoryStats", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        return;
+    TableSetupColumn("Tag");
+    TableSetupColumn("Current");
+    TableSetupColumn("Peak");
+    TableSetupColumn("Active allocs");
+    TableSetupColumn("Total allocs");
+    TableSetupColumn("Last frame");
+    TableHeadersRow();
+    for (int n = 0; n <= ImGuiMemTag_COUNT; n++)
+    {
+        const ImGuiMemTagStats* tag_stats = (n < ImGuiMemTag_COUNT) ? &stats->Tags[n] : &stats->Total;
+        TableNextRow();
+        TableNextColumn();
+        TextUnformatted((n < ImGuiMemTag_COUNT) ? GetMemTagName(n) : "Total");
+        TableNextColumn();
+        Text("%.1f KB", tag_stats->BytesCurrent / 1024.0);
+        TableNextColumn();
+        Text("%.1f KB", tag_stats->BytesPeak / 1024.0);
+        TableNextColumn();
+        Text("%d", tag_stats->AllocsCurrent);
+        TableNextColumn();
+        Text("%d", tag_stats->AllocsTotal);
+        TableNextColumn();
+        if (tag_stats->AllocsLastFrame > 0)
+            TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "%d", tag_stats->AllocsLastFrame);
+        else
+            TextDisabled("0");
+    }
+    EndTable();
+}
+#endif
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+struct ImGuiProfilerWindowStats
+{
+    ImGuiID         WindowID;
+    const char*     Name;
+    ImU64           TicksTotal;
+    ImS64           TicksSelf;      // Excluding child windows
+    int             Calls;
+};
+
+static bool ProfilerWindowStatsLessByTotal(const ImGuiProfilerWindowStats& a, const ImGuiProfilerWindowStats& b) { return a.TicksTotal > b.TicksTotal; }
+static float ProfilerTicksToMs(const ImGuiProfiler* profiler, double ticks) { return (float)(ticks * 1000.0 / (double)profiler->TicksPerSecond); }
+
+// Return ticks spent in zones directly nested in zone_n
+static ImU64 ProfilerCalcZoneChildrenTicks(const ImGuiProfilerFrame* frame, int zone_n)
+{
+    const int depth = frame->Zones[zone_n].Depth;
+    ImU64 ticks = 0;
+    for (int n = zone_n + 1; n < frame->Zones.Size && frame->Zones[n].Depth > depth; n++)
+        if (frame->Zones[n].Depth == depth + 1)
+            ticks += frame->Zones[n].TicksEnd - frame->Zones[n].TicksBegin;
+    return ticks;
+}
+
+// [DEBUG] Display profiler timeline and per-window costs
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    BeginDisabled(profiler->CaptureFile != NULL);
+    Checkbox("Pause", &profiler->Paused);
+    EndDisabled();
+    SameLine();
+    MetricsHelpMarker("Frames are measured from NewFrame() to the next NewFrame().\nWindows are timed from Begin() to End(), which includes their child windows.\nThe implicit \"Debug\" window is not timed.");
+
+    // Chrome Trace Event JSON output, to open with chrome://tracing or https://ui.perfetto.dev
+    SetNextItemWidth(GetFontSize() * 12);
+    InputText("##TraceFilename", profiler->DisplayTraceFilename, IM_ARRAYSIZE(profiler->DisplayTraceFilename));
+    SameLine();
+    if (Button("Export Trace"))
+        ProfilerExportTrace(profiler->DisplayTraceFilename);
+    SameLine();
+    if (profiler->CaptureFile == NULL)
+    {
+        if (Button("Start Capture"))
+            ProfilerStartCapture(profiler->DisplayTraceFilename);
+    }
+    else
+    {
+        if (Button("Stop Capture"))
+            ProfilerStopCapture();
+        SameLine();
+        Text("%d frames", profiler->CaptureFramesCount);
+    }
+    if (profiler->CaptureFailed)
+    {
+        SameLine();
+        TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Capture failed after %d frames: error writing file!", profiler->CaptureFramesCount);
+    }
+    SameLine();
+    MetricsHelpMarker("Export Trace: write the frames displayed below.\nStart Capture: write every frame until stopped.\nOpen the file with chrome://tracing or https://ui.perfetto.dev");
+
+    int frames_count = 0;
+    while (profiler->GetCompletedFrame(frames_count) != NULL)
+        frames_count++;
+    if (frames_count == 0)
+    {
+        TextDisabled("No frame recorded yet.");
+        return;
+    }
+
+    // Frame times, oldest to newest. Click to select a frame.
+    float frame_times[IMGUI_PROFILER_FRAMES_COUNT];
+    float frame_time_max = 0.0f;
+    for (int n = 0; n < frames_count; n++)
+    {
+        const ImGuiProfilerFrame* frame = profiler->GetCompletedFrame(frames_count - 1 - n);
+        frame_times[n] = ProfilerTicksToMs(profiler, (double)(frame->TicksEnd - frame->TicksBegin));
+        frame_time_max = ImMax(frame_time_max, frame_times[n]);
+    }
+    PlotHistogram("##FrameTimes", frame_times, frames_count, 0, NULL, 0.0f, frame_time_max, ImVec2(-FLT_MIN, GetFrameHeight() * 2.0f));
+    if (IsItemClicked())
+        profiler->DisplayFrameOffset = frames_count - 1 - (int)((g.IO.MousePos.x - GetItemRectMin().x) / GetItemRectSize().x * frames_count);
+    profiler->DisplayFrameOffset = ImClamp(profiler->DisplayFrameOffset, 0, frames_count - 1);
+    SetNextItemWidth(GetFontSize() * 12);
+    SliderInt("Frame", &profiler->DisplayFrameOffset, 0, frames_count - 1, "%d frames ago");
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 12);
+    SliderFloat("Zoom", &profiler->DisplayZoom, 1.0f, 100.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+    // Timeline of the selected frame, one row per nesting level
+    const ImGuiProfilerFrame* frame = profiler->GetCompletedFrame(profiler->DisplayFrameOffset);
+    const ImU64 frame_ticks = ImMax(frame->TicksEnd - frame->TicksBegin, (ImU64)1);
+    Text("Frame %d: %.3f ms, %d zones", frame->FrameCount, ProfilerTicksToMs(profiler, (double)frame_ticks), frame->Zones.Size);
+    int depth_count = 1;
+    for (int zone_n = 0; zone_n < frame->Zones.Size; zone_n++)
+        depth_count = ImMax(depth_count, frame->Zones[zone_n].Depth + 1);
+    const float row_height = GetFrameHeight();
+    const float timeline_height = row_height * ImMin(depth_count, 16) + g.Style.ScrollbarSize + g.Style.WindowPadding.y * 2.0f;
+    if (BeginChild("##Timeline", ImVec2(-FLT_MIN, timeline_height), true, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGuiWindow* window = GetCurrentWindow();
+        const ImVec2 origin = GetCursorScreenPos();
+        const float width = GetContentRegionAvail().x * profiler->DisplayZoom;
+        Dummy(ImVec2(width, row_height * depth_count));
+        const double ticks_to_x = width / (double)frame_ticks;
+        int hovered_zone_n = -1;
+        for (int zone_n = 0; zone_n < frame->Zones.Size; zone_n++)
+        {
+            const ImGuiProfilerZone& zone = frame->Zones[zone_n];
+            ImRect bb;
+            bb.Min.x = origin.x + (float)((double)(zone.TicksBegin - frame->TicksBegin) * ticks_to_x);
+            bb.Max.x = ImMax(origin.x + (float)((double)(zone.TicksEnd - frame->TicksBegin) * ticks_to_x), bb.Min.x + 1.0f);
+            bb.Min.y = origin.y + zone.Depth * row_height;
+            bb.Max.y = bb.Min.y + row_height - 1.0f;
+            if (!bb.Overlaps(window->ClipRect))
+                continue;
+            const float hue = (ImHashStr(zone.Name) & 0xFF) / 255.0f;
+            window->DrawList->AddRectFilled(bb.Min, bb.Max, ImColor::HSV(hue, 0.45f, zone.WindowID ? 0.60f : 0.40f));
+            if (bb.GetWidth() > g.FontSize)
+                RenderTextClipped(bb.Min + ImVec2(g.Style.FramePadding.x, 0.0f), bb.Max, zone.Name, FindRenderedTextEnd(zone.Name), NULL, ImVec2(0.0f, 0.5f), &bb);
+            if (IsWindowHovered() && bb.Contains(g.IO.MousePos))
+                hovered_zone_n = zone_n;
+        }
+        if (hovered_zone_n != -1)
+        {
+            const ImGuiProfilerZone& zone = frame->Zones[hovered_zone_n];
+            const ImU64 zone_ticks = zone.TicksEnd - zone.TicksBegin;
+            SetTooltip("%.*s\n%.3f ms (self %.3f ms)", (int)(FindRenderedTextEnd(zone.Name) - zone.Name), zone.Name, ProfilerTicksToMs(profiler, (double)zone_ticks), ProfilerTicksToMs(profiler, (double)(zone_ticks - ProfilerCalcZoneChildrenTicks(frame, hovered_zone_n))));
+            if (ImGuiWindow* zone_window = zone.WindowID ? FindWindowByID(zone.WindowID) : NULL)
+                GetForegroundDrawList()->AddRect(zone_window->Pos, zone_window->Pos + zone_window->Size, IM_COL32(255, 255, 0, 255));
+        }
+    }
+    EndChild();
+
+    // Per-window costs, averaged over recorded frames. Self time excludes child windows (but includes other zones, e.g. tables layout).
+    ImVector<ImGuiProfilerWindowStats> stats;
+    ImGuiStorage stats_idx_by_id;
+    ImVector<int> window_zone_by_depth; // For each depth: innermost window zone containing the current zone, or the zone itself
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        const ImGuiProfilerFrame* stats_frame = profiler->GetCompletedFrame(frame_n);
+        for (int zone_n = 0; zone_n < stats_frame->Zones.Size; zone_n++)
+        {
+            const ImGuiProfilerZone& zone = stats_frame->Zones[zone_n];
+            if (window_zone_by_depth.Size <= zone.Depth)
+                window_zone_by_depth.resize(zone.Depth + 1);
+            const int parent_window_zone_n = (zone.Depth > 0) ? window_zone_by_depth[zone.Depth - 1] : -1;
+            window_zone_by_depth[zone.Depth] = zone.WindowID ? zone_n : parent_window_zone_n;
+            if (zone.WindowID == 0)
+                continue;
+            int* p_idx = stats_idx_by_id.GetIntRef(zone.WindowID, -1);
+            if (*p_idx == -1)
+            {
+                *p_idx = stats.Size;
+                ImGuiProfilerWindowStats new_stats = { zone.WindowID, zone.Name, 0, 0, 0 };
+                stats.push_back(new_stats);
+            }
+            const ImU64 zone_ticks = zone.TicksEnd - zone.TicksBegin;
+            stats[*p_idx].TicksTotal += zone_ticks;
+            stats[*p_idx].TicksSelf += (ImS64)zone_ticks;
+            stats[*p_idx].Calls++;
+            if (parent_window_zone_n != -1)
+                stats[stats_idx_by_id.GetInt(stats_frame->Zones[parent_window_zone_n].WindowID)].TicksSelf -= (ImS64)zone_ticks;
+        }
+    }
+    ImSort<ImGuiProfilerWindowStats, ProfilerWindowStatsLessByTotal>(stats.Data, stats.Size);
+
+    Text("Windows: average over %d frames", frames_count);
+    if (BeginTable("##Windows", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Total (ms)");
+        TableSetupColumn("Self (ms)");
+        TableSetupColumn("Calls");
+        TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(stats.Size);
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const ImGuiProfilerWindowStats& window_stats = stats[n];
+                TableNextRow();
+                TableNextColumn();
+                TextUnformatted(window_stats.Name, FindRenderedTextEnd(window_stats.Name));
+                if (IsItemHovered())
+                    if (ImGuiWindow* stats_window = FindWindowByID(window_stats.WindowID))
+                        GetForegroundDrawList()->AddRect(stats_window->Pos, stats_window->Pos + stats_window->Size, IM_COL32(255, 255, 0, 255));
+                TableNextColumn();
+                Text("%.3f", ProfilerTicksToMs(profiler, (double)window_stats.TicksTotal / frames_count));
+                TableNextColumn();
+                Text("%.3f", ProfilerTicksToMs(profiler, (double)window_stats.TicksSelf / frames_count));
+                TableNextColumn();
+                Text("%.1f", (float)window_stats.Calls / frames_count);
+            }
+        EndTable();
+    }
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
@@ -13249,9 +15200,11 @@ void ImGui::DebugLog(const char* fmt, ...)
 void ImGui::DebugLogV(const char* fmt, va_list args)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Logging);
     const int old_size = g.DebugLogBuf.size();
     g.DebugLogBuf.appendf("[%05d] ", g.FrameCount);
     g.DebugLogBuf.appendfv(fmt, args);
+    g.DebugLogIndex.append(g.DebugLogBuf.c_str(), old_size, g.DebugLogBuf.size());
     if (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTTY)
         IMGUI_DEBUG_PRINTF("%s", g.DebugLogBuf.begin() + old_size);
 }
@@ -13277,12 +15230,15 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     SameLine(); CheckboxFlags("IO", &g.DebugLogFlags, ImGuiDebugLogFlags_EventIO);
 
     if (SmallButton("Clear"))
+    {
         g.DebugLogBuf.clear();
+        g.DebugLogIndex.clear();
+    }
     SameLine();
     if (SmallButton("Copy"))
         SetClipboardText(g.DebugLogBuf.c_str());
     BeginChild("##log", ImVec2(0.0f, 0.0f), true, ImGuiWindowFlags_AlwaysVerticalScrollbar | ImGuiWindowFlags_AlwaysHorizontalScrollbar);
-    TextUnformatted(g.DebugLogBuf.begin(), g.DebugLogBuf.end()); // FIXME-OPT: Could use a line index, but TextUnformatted() has a semi-decent fast path for large text.
+    TextIndexed(g.DebugLogBuf.c_str(), &g.DebugLogIndex);
     if (GetScrollY() >= GetScrollMaxY())
         SetScrollHereY(1.0f);
     EndChild();
@@ -13517,6 +15473,12 @@ void ImGui::DebugNodeColumns(ImGuiOldColumns*) {}
 void ImGui::DebugNodeDrawList(ImGuiWindow*, const ImDrawList*, const char*) {}
 void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList*, const ImDrawCmd*, bool, bool) {}
 void ImGui::DebugNodeFont(ImFont*) {}
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+void ImGui::DebugNodeMemoryStats(const ImGuiMemStats*) {}
+#endif
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
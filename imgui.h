@@ -30,10 +30,10 @@ Index of this file:
 // [SECTION] Helpers: Memory allocations macros, ImVector<>
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
-// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs, ImGuiFrameStats)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiLabelLiteral, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
-// [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
+// [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont, ImTextBlob)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
 // [SECTION] Platform Dependent Interfaces (ImGuiPlatformImeData)
 // [SECTION] Obsolete functions and types
@@ -146,9 +146,11 @@ struct ImFontGlyph;                 // A single font glyph (code point + coordin
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
+struct ImGuiFrameStats;             // Counters and timings of the last frame (see GetFrameStats())
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
+struct ImGuiLabelLiteral;           // Helper holding a label hashed at compile time (see IM_LABEL())
 struct ImGuiListClipper;            // Helper to manually clip large list of items
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -161,6 +163,7 @@ struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
+struct ImTextBlob;                  // Text shaped once into glyph quads, to be drawn many times with ImDrawList::AddTextBlob()
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags without overhead, and to not pollute the top of this file)
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
@@ -292,6 +295,7 @@ namespace ImGui
     IMGUI_API void          EndFrame();                                 // ends the Dear ImGui frame. automatically called by Render(). If you don't need to render data (skipping rendering) you may call EndFrame() without Render()... but you'll have wasted CPU already! If you don't need to render, better to not create any windows and not call NewFrame() at all!
     IMGUI_API void          Render();                                   // ends the Dear ImGui frame, finalize the draw data. You can then get call GetDrawData().
     IMGUI_API ImDrawData*   GetDrawData();                              // valid after Render() and until the next call to NewFrame(). this is what you have to render.
+    IMGUI_API const ImGuiFrameStats& GetFrameStats();                   // counters and timings of the last frame (items, text, IDs, draw calls, allocations, time per phase). updated by EndFrame() and Render().
 
     // Demo, Debug, Information
     IMGUI_API void          ShowDemoWindow(bool* p_open = NULL);        // create Demo window. demonstrate most ImGui features. call this to learn about the library! try to make it always available in your application!
@@ -466,10 +470,12 @@ namespace ImGui
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(const ImGuiLabelLiteral& str_id);                        // push string hashed at compile time with IM_LABEL() into the ID stack (same ID as the string version, without hashing the string).
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
+    IMGUI_API ImGuiID       GetID(const ImGuiLabelLiteral& str_id);
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
@@ -490,10 +496,13 @@ namespace ImGui
     // - Most widgets return true when the value has been changed or when pressed/selected
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(const char* label, const ImVec2& size = ImVec2(0, 0));   // button
+    IMGUI_API bool          Button(const char* label, const char* label_end, const ImVec2& size = ImVec2(0, 0)); // label with known end: doesn't require null terminated string, no strlen()
+    IMGUI_API bool          Button(const ImGuiLabelLiteral& label, const ImVec2& size = ImVec2(0, 0)); // label hashed at compile time with IM_LABEL(): e.g. Button(IM_LABEL("Save"))
     IMGUI_API bool          SmallButton(const char* label);                                 // button with FramePadding=(0,0) to easily embed within text
     IMGUI_API bool          InvisibleButton(const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
     IMGUI_API bool          Checkbox(const char* label, bool* v);
+    IMGUI_API bool          Checkbox(const ImGuiLabelLiteral& label, bool* v);
     IMGUI_API bool          CheckboxFlags(const char* label, int* flags, int flags_value);
     IMGUI_API bool          CheckboxFlags(const char* label, unsigned int* flags, unsigned int flags_value);
     IMGUI_API bool          RadioButton(const char* label, bool active);                    // use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
@@ -592,11 +601,13 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(const ImGuiLabelLiteral& label);
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
     IMGUI_API bool          TreeNodeV(const void* ptr_id, const char* fmt, va_list args) IM_FMTLIST(2);
     IMGUI_API bool          TreeNodeEx(const char* label, ImGuiTreeNodeFlags flags = 0);
+    IMGUI_API bool          TreeNodeEx(const char* label, const char* label_end, ImGuiTreeNodeFlags flags); // label with known end: doesn't require null terminated string, no strlen()
     IMGUI_API bool          TreeNodeEx(const char* str_id, ImGuiTreeNodeFlags flags, const char* fmt, ...) IM_FMTARGS(3);
     IMGUI_API bool          TreeNodeEx(const void* ptr_id, ImGuiTreeNodeFlags flags, const char* fmt, ...) IM_FMTARGS(3);
     IMGUI_API bool          TreeNodeExV(const char* str_id, ImGuiTreeNodeFlags flags, const char* fmt, va_list args) IM_FMTLIST(3);
@@ -614,6 +625,8 @@ namespace ImGui
     // - Neighbors selectable extend their highlight bounds in order to leave no gap between them. This is so a series of selected Selectable appear contiguous.
     IMGUI_API bool          Selectable(const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
     IMGUI_API bool          Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
+    IMGUI_API bool          Selectable(const char* label, const char* label_end, bool selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // label with known end: doesn't require null terminated string, no strlen()
+    IMGUI_API bool          Selectable(const char* label, const char* label_end, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
 
     // Widgets: List Boxes
     // - This is essentially a thin wrapper to using BeginChild/EndChild with some stylistic changes.
@@ -1507,6 +1520,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasSdfFonts   = 1 << 4,   // Backend Renderer supports font atlases built with ImFontAtlasFlags_SignedDistanceField (font texture is sampled as a distance field).
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1923,6 +1937,8 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigTextSizeCache;            // = false          // [BETA] Cache results of CalcTextSize() keyed by text contents, font, size and wrap width. Faster when submitting many labels every frame, at the cost of hashing and comparing the text. See Metrics->Text size cache.
+    bool        ConfigWrappedTextLayoutCache;   // = false          // Cache line breaks of long word-wrapped text (e.g. TextWrapped(), CalcTextSize() with a wrap width) keyed by text contents, font, size and wrap width. Lines outside of the clipping rectangle are skipped when rendering with an integer font size.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -2142,8 +2158,39 @@ struct ImGuiTableSortSpecs
     ImGuiTableSortSpecs()       { memset(this, 0, sizeof(*this)); }
 };
 
+// Counters and timings of the last frame, obtained by calling GetFrameStats(). Always enabled: counting only costs a few increments.
+// Counters are accumulated from NewFrame() to Render(). The snapshot is updated at the end of EndFrame(), then again at the end of Render().
+struct ImGuiFrameStats
+{
+    int         FrameCount;             // Frame these statistics were measured on (value of GetFrameCount() during that frame)
+
+    // Items, text, IDs
+    int         ItemsSubmitted;         // Items submitted by widgets (ItemAdd() calls), visible or not
+    int         ItemsClipped;           // Items submitted but not visible, which widgets skip rendering for. Use ImGuiListClipper to avoid submitting them at all.
+    int         CalcTextSizeCalls;      // CalcTextSize() calls
+    int         IdHashCalls;            // IDs computed from the ID stack (GetID() calls, including the ones done by widgets)
+    int         SettingsWrites;         // .ini settings serialized (SaveIniSettingsToMemory() calls, including automatic saves to io.IniFilename)
+
+    // Memory (via MemAlloc(), using the allocator set with SetAllocatorFunctions())
+    int         Allocations;            // Allocations count
+    size_t      AllocatedBytes;         // Allocations total size in bytes
+
+    // Rendering (set by Render())
+    int         DrawLists;              // Draw lists in the draw data
+    int         DrawCalls;              // Draw commands in the draw data (ImDrawCmd)
+    int         DrawListBytes;          // Size of vertex, index and command buffers in the draw data
+
+    // Time spent in each phase, in milliseconds
+    float       TimeNewFrame;           // NewFrame()
+    float       TimeUser;               // From the end of NewFrame() to EndFrame(): your code submitting windows and widgets
+    float       TimeEndFrame;           // EndFrame()
+    float       TimeRender;             // Render(), not counting the implicit EndFrame() call (set by Render())
+
+    ImGuiFrameStats()           { memset(this, 0, sizeof(*this)); }
+};
+
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiLabelLiteral, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2163,12 +2210,42 @@ struct ImGuiOnceUponAFrame
     operator bool() const { int current_frame = ImGui::GetFrameCount(); if (RefFrame == current_frame) return false; RefFrame = current_frame; return true; }
 };
 
+// Helper: Label with its hash computed at compile time, to be combined with the ID stack at runtime instead of hashing the string every frame.
+// Usage: ImGui::Button(IM_LABEL("Save")); ImGui::TreeNode(IM_LABEL("Details##node")); ImGui::PushID(IM_LABEL("settings"));
+// - The resulting ID is the same as with the string version, e.g. ImGui::GetID(IM_LABEL("Save")) == ImGui::GetID("Save"). "##" and "###" are supported.
+// - Use IM_LABEL() with a string literal, which guarantees the hash is computed at compile time (even in Debug builds).
+// - Hashing is recursive to be usable in C++11 constant expressions, so labels are limited by the compiler constexpr depth (typically 512 characters).
+#define IM_LABEL(_LABEL)    ImGuiLabelLiteral(_LABEL, ImGuiLabelLiteral::Const<ImGuiLabelLiteral::CalcHashCrc(_LABEL)>::Value, ImGuiLabelLiteral::Const<ImGuiLabelLiteral::CalcHashSize(_LABEL)>::Value)
+struct ImGuiLabelLiteral
+{
+    const char* Label;          // Zero-terminated label. Part after "##" is not displayed.
+    ImU32       HashCrc;        // CRC of the hashed part of the label (from the last "###" if any, else the whole label), starting from a zero state.
+    ImU32       HashSize;       // Size of the hashed part of the label.
+
+    constexpr ImGuiLabelLiteral(const char* label, ImU32 hash_crc, ImU32 hash_size) : Label(label), HashCrc(hash_crc), HashSize(hash_size) {}
+
+    // [Internal] Compile-time helpers. Must match ImHashStr().
+    template<ImU32 V> struct Const { static const ImU32 Value = V; };
+#ifdef IMGUI_USE_CRC32C_HASH
+    static constexpr ImU32 CrcPoly()                                            { return 0x82F63B78; }
+#else
+    static constexpr ImU32 CrcPoly()                                            { return 0xEDB88320; }
+#endif
+    static constexpr ImU32 CrcByte(ImU32 crc, int bits)                         { return bits == 0 ? crc : CrcByte((crc >> 1) ^ ((crc & 1) ? CrcPoly() : 0), bits - 1); }
+    static constexpr ImU32 CrcBytes(const char* s, int i, int len, ImU32 crc)   { return i == len ? crc : CrcBytes(s, i + 1, len, CrcByte(crc ^ (unsigned char)s[i], 8)); }
+    static constexpr int   Strlen(const char* s, int i)                         { return s[i] ? Strlen(s, i + 1) : i; }
+    static constexpr int   FindHashBegin(const char* s, int i, int last)        { return (!s[i] || !s[i + 1] || !s[i + 2]) ? last : FindHashBegin(s, i + 1, (s[i] == '#' && s[i + 1] == '#' && s[i + 2] == '#') ? i : last); }
+    static constexpr ImU32 CalcHashCrc(const char* s)                           { return CrcBytes(s, FindHashBegin(s, 0, 0), Strlen(s, 0), 0); }
+    static constexpr ImU32 CalcHashSize(const char* s)                          { return (ImU32)(Strlen(s, 0) - FindHashBegin(s, 0, 0)); }
+};
+
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 struct ImGuiTextFilter
 {
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API void      PassFilterBatch(const char* const* texts, const char* const* texts_end, int texts_count, ImU32* out_bits) const; // Write result of PassFilter(texts[n], texts_end ? texts_end[n] : NULL) to bit n of out_bits[], which must have (texts_count + 31) / 32 entries. Entire words are written: to process parts of a large array in multiple threads, split it at multiples of 32 items.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2184,9 +2261,17 @@ struct ImGuiTextFilter
         bool            empty() const                   { return b == e; }
         IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
     };
+    struct ImGuiTextFilterTerm      // Non-empty filter, precompiled by Build() for PassFilter()
+    {
+        int             Offset;     // Offset of the needle in TermsUpper[]
+        int             Len;
+        bool            Exclude;    // Filter starting with '-'
+    };
     char                    InputBuf[256];
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
+    ImVector<ImGuiTextFilterTerm> Terms;
+    ImVector<char>          TermsUpper; // Upper-case copy of InputBuf[]
 };
 
 // Helper: Growable text buffer for logging/accumulating text
@@ -2231,11 +2316,22 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    ImVector<int>                   HashTable;      // Open addressing (linear probing) table of indices into Data[], + 1 (0 = empty slot)
+    int                             HashedCount;    // Number of Data[] entries indexed in HashTable[]. When different from Data.Size (e.g. after Data.push_back() + BuildSortByKey()), HashTable[] is rebuilt.
+
+    ImGuiStorage()      { HashedCount = 0; }
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    //   With '#define IMGUI_USE_HASHED_STORAGE': pairs are stored in insertion order and indexed by a hash table, query and insertion are O(1)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); HashTable.clear(); HashedCount = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2258,6 +2354,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (Also call this after modifying keys in Data[] directly)
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2540,6 +2637,7 @@ struct ImDrawList
     IMGUI_API void  AddNgonFilled(const ImVec2& center, float radius, ImU32 col, int num_segments);
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
+    IMGUI_API void  AddTextBlob(ImTextBlob* blob, const ImVec2& pos, ImU32 col);  // Draw pre-shaped text (see ImTextBlob). Output matches AddText() with same font/size/wrap_width, without cpu fine clipping.
     IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, ImDrawFlags flags, float thickness);
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
     IMGUI_API void  AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
@@ -2633,7 +2731,7 @@ struct ImDrawData
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont)
+// [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont, ImTextBlob)
 //-----------------------------------------------------------------------------
 
 struct ImFontConfig
@@ -2707,10 +2805,11 @@ struct ImFontAtlasCustomRect
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
-    ImFontAtlasFlags_None               = 0,
-    ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_None                = 0,
+    ImFontAtlasFlags_NoPowerOfTwoHeight  = 1 << 0,   // Don't round the height to next power of two
+    ImFontAtlasFlags_NoMouseCursors      = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
+    ImFontAtlasFlags_NoBakedLines        = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_SignedDistanceField = 1 << 3,   // Rasterize glyphs once as signed distance fields, so a single font can be rendered sharply at any size/scale. Requires a renderer backend with ImGuiBackendFlags_RendererHasSdfFonts (see TexSdfGlyphsMinY). stb_truetype builder only.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2799,6 +2898,7 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
+    int                         TexSdfSpread;       // Distance in pixels encoded around each glyph when using ImFontAtlasFlags_SignedDistanceField. Defaults to 4. Larger values allow more downscaling/upscaling and effects at the cost of texture space.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
 
     // [Internal]
@@ -2811,6 +2911,7 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
+    int                         TexSdfGlyphsMinY;   // With ImFontAtlasFlags_SignedDistanceField: glyphs are packed at or below this texture row, custom rectangles (white pixel, mouse cursors, baked lines, user rects) above it. Renderers only apply the distance field threshold from this row.
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
@@ -2823,6 +2924,8 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         TexPackedSurface;   // Surface of all packed rectangles (including padding) during last Build(), to compute texture occupancy.
+    int                         BuildId;            // Unique identifier of last Build() (unique across all atlases), to invalidate data derived from fonts (e.g. CalcTextSize() cache).
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2833,13 +2936,14 @@ struct ImFontAtlas
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~24/28 bytes (for CalcTextSize)
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI). Only covers the lower, densely used codepoints: see IndexPagesMap.
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
+    float                       MonospaceAdvanceX;  // 4     // out // = 0.f      // Advance shared by all glyphs (except TAB) if the font is monospace, 0.0f otherwise. Detected by BuildLookupTable(), cleared by AddRemapChar() if needed.
 
     // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point. Same range as IndexAdvanceX.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
@@ -2855,14 +2959,18 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImVector<ImU16>             IndexPagesMap;      // 12-16 // out //            // Codepoints above IndexLookup.Size are looked up in 256-entries pages: IndexPagesMap[c >> 8] is 0 for an unused page, otherwise (page number + 1).
+    ImVector<ImWchar>           IndexPagesLookup;   // 12-16 // out //            // Paged equivalent of IndexLookup[]: 256 entries per page.
+    ImVector<float>             IndexPagesAdvanceX; // 12-16 // out //            // Paged equivalent of IndexAdvanceX[]: 256 entries per page.
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : GetCharAdvancePaged(c); }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
+    bool                        IsMonospace() const                 { return MonospaceAdvanceX > 0.0f; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
@@ -2876,12 +2984,37 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
     IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API float             GetCharAdvancePaged(ImWchar c) const;
+    IMGUI_API void              SetIndexEntry(ImWchar c, ImWchar glyph_index, float advance_x);
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
     IMGUI_API bool              IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last);
 };
 
+// Text shaped once into glyph quads (relative to its top-left corner), to be drawn any number of times with ImDrawList::AddTextBlob().
+// - Drawing a blob copies its vertices with an offset and a color, instead of decoding, looking up and laying out every glyph again.
+//   Useful for static labels and large help panels, which are otherwise laid out again every frame.
+// - Lines outside of the current clipping rectangle are skipped. Blobs keep a copy of their text, and are automatically shaped again
+//   if their font atlas has been rebuilt. The ImFont pointer needs to stay valid while the blob is in use.
+struct ImTextBlob
+{
+    ImVector<ImDrawVert>        Vtx;                // 4 vertices per visible glyph, relative to origin. 'col' is 0 for regular glyphs, ~0 for colored glyphs (untinted).
+    ImVector<int>               LineVtxStart;       // Index of first vertex of each line in Vtx[] (LinesCount + 1 entries, last one is Vtx.Size). Line N starts at y = N * FontSize.
+    ImVector<char>              Text;               // Copy of source text (zero-terminated)
+    const ImFont*               Font;
+    float                       FontSize;
+    float                       WrapWidth;
+    int                         FontAtlasBuildId;   // ImFontAtlas::BuildId at the time of shaping
+    ImVec2                      Size;               // Same as ImFont::CalcTextSizeA() output
+
+    ImTextBlob()                { Font = NULL; FontSize = WrapWidth = 0.0f; FontAtlasBuildId = 0; }
+    void                        Clear() { Vtx.clear(); LineVtxStart.clear(); Text.clear(); Font = NULL; FontSize = WrapWidth = 0.0f; FontAtlasBuildId = 0; Size = ImVec2(0.0f, 0.0f); }
+    int                         GetLinesCount() const { return LineVtxStart.Size > 0 ? LineVtxStart.Size - 1 : 0; }
+    bool                        IsStale() const { return Font != NULL && Font->ContainerAtlas != NULL && Font->ContainerAtlas->BuildId != FontAtlasBuildId; }
+    IMGUI_API void              Build(const ImFont* font, float font_size, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Viewports
 //-----------------------------------------------------------------------------
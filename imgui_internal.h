@@ -60,6 +60,19 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable hardware CRC32C instructions for ImHashData()/ImHashStr() (see IMGUI_USE_CRC32C_HASH in imconfig.h)
+#ifdef IMGUI_USE_CRC32C_HASH
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE4_2__ || defined __AVX__)
+#define IMGUI_ENABLE_SSE4_2_CRC
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#define IMGUI_ENABLE_ARM_CRC
+#include <arm_acle.h>
+#else
+#error "IMGUI_USE_CRC32C_HASH requires SSE4.2 (e.g. -msse4.2 or /arch:AVX) or ARMv8 CRC32 (e.g. -march=armv8-a+crc) instructions."
+#endif
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -129,6 +142,7 @@ struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfiler;               // Storage for the built-in CPU profiler (IMGUI_ENABLE_PROFILER)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
@@ -140,6 +154,9 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextSizeCache;          // Cache for CalcTextSize() results
+struct ImGuiWrappedTextLayout;      // Line breaks of a word-wrapped text
+struct ImGuiWrappedTextLayoutCache; // Cache of line breaks for long word-wrapped text
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
@@ -151,6 +168,7 @@ typedef int ImGuiDebugLogFlags;         // -> enum ImGuiDebugLogFlags_      // F
 typedef int ImGuiInputFlags;            // -> enum ImGuiInputFlags_         // Flags: for IsKeyPressedEx()
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
 typedef int ImGuiItemStatusFlags;       // -> enum ImGuiItemStatusFlags_    // Flags: for DC.LastItemStatusFlags
+typedef int ImGuiMemTag;                // -> enum ImGuiMemTag_             // Enum: Subsystem an allocation is accounted to (IMGUI_ENABLE_MEMORY_TRACKING)
 typedef int ImGuiOldColumnFlags;        // -> enum ImGuiOldColumnFlags_     // Flags: for BeginColumns()
 typedef int ImGuiNavHighlightFlags;     // -> enum ImGuiNavHighlightFlags_  // Flags: for RenderNavHighlight()
 typedef int ImGuiNavMoveFlags;          // -> enum ImGuiNavMoveFlags_       // Flags: for navigation requests
@@ -212,6 +230,26 @@ namespace ImStb
 #define IMGUI_DEBUG_LOG_NAV(...)        do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventNav)      IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 #define IMGUI_DEBUG_LOG_IO(...)         do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventIO)       IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 
+// Profiler zones (see IMGUI_ENABLE_PROFILER in imconfig.h). Zones must be properly nested and cannot span a call to NewFrame().
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME)            ImGui::ProfilerZoneBegin(_NAME)             // _NAME is not copied: use a string literal
+#define IMGUI_PROFILER_ZONE_BEGIN_WINDOW(_WINDOW)   ImGui::ProfilerZoneBegin((_WINDOW)->Name, (_WINDOW)->ID)
+#define IMGUI_PROFILER_ZONE_END()                   ImGui::ProfilerZoneEnd()
+#define IMGUI_PROFILER_SCOPE(_NAME)                 ImGuiProfilerScope profiler_scope(_NAME)    // Zone ending with the current scope
+#else
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME)            ((void)0)
+#define IMGUI_PROFILER_ZONE_BEGIN_WINDOW(_WINDOW)   ((void)0)
+#define IMGUI_PROFILER_ZONE_END()                   ((void)0)
+#define IMGUI_PROFILER_SCOPE(_NAME)                 ((void)0)
+#endif
+
+// Memory tracking (see IMGUI_ENABLE_MEMORY_TRACKING in imconfig.h). Allocations made until the end of the current scope are accounted to _TAG (innermost scope wins).
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+#define IMGUI_MEM_TAG_SCOPE(_TAG)                   ImGuiMemTagScope mem_tag_scope(_TAG)
+#else
+#define IMGUI_MEM_TAG_SCOPE(_TAG)                   ((void)0)
+#endif
+
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
 
@@ -301,13 +339,16 @@ namespace ImStb
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImSort<>, ImSortRadix<>
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+IMGUI_API ImGuiID       ImHashCombine(ImU32 crc, size_t data_size, ImU32 seed);     // Same result as ImHashData(data, data_size, seed), given crc = CRC of data from a zero state (e.g. computed at compile time, see ImGuiLabelLiteral)
 
 // Helpers: Sorting
+// (internal code uses ImSort<> and ImSortRadix<> declared further below, ImQsort() is used by stb_rect_pack)
 #ifndef ImQsort
 static inline void      ImQsort(void* base, size_t count, size_t size_of_element, int(IMGUI_CDECL *compare_func)(void const*, void const*)) { if (count > 1) qsort(base, count, size_of_element, compare_func); }
 #endif
@@ -334,6 +375,8 @@ IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end
 IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API const char*   ImStrSkipBlank(const char* str);
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
+static inline char      ImToUpper(char c)               { return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c; }
+static inline char      ImToLower(char c)               { return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
 
 // Helpers: Formatting
@@ -356,6 +399,7 @@ IMGUI_API int           ImTextStrFromUtf8(ImWchar* out_buf, int out_buf_size, co
 IMGUI_API int           ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end);                                 // return number of UTF-8 code-points (NOT bytes count)
 IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const char* in_text_end);                             // return number of bytes to express one char in UTF-8
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
+IMGUI_API const char*   ImTextFindNonPrintableAscii(const char* in_text, const char* in_text_end);                              // return first byte which is not in 0x20..0x7F range, or in_text_end. Scan 16 bytes at a time with SSE.
 
 // Helpers: ImVec2/ImVec4 operators
 // We are keeping those disabled by default so they don't leak in user space, to allow user enabling implicit cast operators between ImVec2 and their own types (using IM_VEC2_CLASS_EXTRA etc.)
@@ -402,6 +446,10 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: Time
+IMGUI_API ImU64             ImTimeGetTicks();               // Monotonic high resolution timer: QueryPerformanceCounter() or clock_gettime(CLOCK_MONOTONIC)
+IMGUI_API ImU64             ImTimeGetTicksPerSecond();
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -690,6 +738,160 @@ struct ImChunkStream
 
 };
 
+// Helper: ImSort<>, ImSortRadix<>
+// Typed replacements for qsort(), letting the compiler inline comparisons instead of calling a function pointer for each of them.
+// - ImSort<T, LESS>(data, count): introsort. Quicksort with median-of-3 pivot, switching to heapsort when recursing too deep, and insertion sort for small ranges. Not stable.
+// - ImSortRadix<T, GET_KEY>(data, count, temp_buffer): stable LSD radix sort on 32-bit keys (e.g. ImGuiID), requiring a temporary buffer of 'count' elements.
+//   Faster than ImSort<> for a few hundred elements or more. T is copied with memcpy().
+template<typename T, bool (*LESS)(const T&, const T&)>
+struct ImSortImpl
+{
+    static inline void Swap(T& a, T& b)         { T tmp = a; a = b; b = tmp; }
+    static void InsertionSort(T* first, T* last)
+    {
+        for (T* it = first + 1; it < last; it++)
+        {
+            T tmp = *it;
+            T* dst = it;
+            for (; dst > first && LESS(tmp, dst[-1]); dst--)
+                *dst = dst[-1];
+            *dst = tmp;
+        }
+    }
+    static void SiftDown(T* data, int root, int count)
+    {
+        T tmp = data[root];
+        for (int child = root * 2 + 1; child < count; root = child, child = root * 2 + 1)
+        {
+            if (child + 1 < count && LESS(data[child], data[child + 1]))
+                child++;
+            if (!LESS(tmp, data[child]))
+                break;
+            data[root] = data[child];
+        }
+        data[root] = tmp;
+    }
+    static void HeapSort(T* data, int count)
+    {
+        for (int n = count / 2 - 1; n >= 0; n--)
+            SiftDown(data, n, count);
+        for (int n = count - 1; n > 0; n--)
+        {
+            Swap(data[0], data[n]);
+            SiftDown(data, 0, n);
+        }
+    }
+    static void IntroSort(T* first, T* last, int depth_limit)
+    {
+        while (last - first > 16)
+        {
+            if (depth_limit-- == 0)
+            {
+                HeapSort(first, (int)(last - first));
+                return;
+            }
+
+            // Move median of 3 to first[0] to be used as pivot. The smallest and largest of them act as sentinels for the partitioning loops.
+            T* a = first + 1;
+            T* b = first + (last - first) / 2;
+            T* c = last - 1;
+            if (LESS(*a, *b))
+                Swap(*first, LESS(*b, *c) ? *b : LESS(*a, *c) ? *c : *a);
+            else
+                Swap(*first, LESS(*a, *c) ? *a : LESS(*b, *c) ? *c : *b);
+
+            T* lo = first + 1;
+            T* hi = last;
+            while (true)
+            {
+                while (LESS(*lo, *first))
+                    lo++;
+                hi--;
+                while (LESS(*first, *hi))
+                    hi--;
+                if (!(lo < hi))
+                    break;
+                Swap(*lo, *hi);
+                lo++;
+            }
+            IntroSort(lo, last, depth_limit);
+            last = lo;
+        }
+        InsertionSort(first, last);
+    }
+};
+
+template<typename T, bool (*LESS)(const T&, const T&)>
+static inline void ImSort(T* data, int count)
+{
+    if (count <= 1)
+        return;
+    int depth_limit = 0;
+    for (int n = count; n > 1; n >>= 1)
+        depth_limit += 2;
+    ImSortImpl<T, LESS>::IntroSort(data, data + count, depth_limit);
+}
+
+template<typename T, ImU32 (*GET_KEY)(const T&)>
+static inline void ImSortRadix(T* data, int count, T* temp_buffer)
+{
+    if (count <= 1)
+        return;
+    int offsets[4][256];
+    memset(offsets, 0, sizeof(offsets));
+    for (int n = 0; n < count; n++)
+    {
+        const ImU32 key = GET_KEY(data[n]);
+        offsets[0][key & 0xFF]++;
+        offsets[1][(key >> 8) & 0xFF]++;
+        offsets[2][(key >> 16) & 0xFF]++;
+        offsets[3][key >> 24]++;
+    }
+    T* src = data;
+    T* dst = temp_buffer;
+    for (int pass = 0; pass < 4; pass++)
+    {
+        // Skip passes where all keys have the same digit
+        const int shift = pass * 8;
+        int* pass_offsets = offsets[pass];
+        if (pass_offsets[(GET_KEY(src[0]) >> shift) & 0xFF] == count)
+            continue;
+        for (int digit = 0, offset = 0; digit < 256; digit++)
+        {
+            const int digit_count = pass_offsets[digit];
+            pass_offsets[digit] = offset;
+            offset += digit_count;
+        }
+        for (int n = 0; n < count; n++)
+            memcpy(&dst[pass_offsets[(GET_KEY(src[n]) >> shift) & 0xFF]++], &src[n], sizeof(T));
+        T* tmp = src; src = dst; dst = tmp;
+    }
+    if (src != data)
+        memcpy(data, src, (size_t)count * sizeof(T));
+}
+
+// Helper: ImGuiTextIndex
+// Maintain a line index for a text buffer we don't own, extended incrementally with append() as text gets added at the end of the buffer.
+// Also caches the width of the widest line, so large logs can be displayed with TextIndexed() in O(visible lines) per frame.
+struct ImGuiTextIndex
+{
+    ImVector<int>   LineOffsets;
+    int             EndOffset;                              // Because we don't own text buffer we need to maintain EndOffset
+    float           MaxLineWidth;                           // Width of widest line among the first MaxLineWidthLines lines, see CalcMaxLineWidth()
+    int             MaxLineWidthLines;
+    ImFont*         MaxLineWidthFont;                       // Font, size and atlas build used for MaxLineWidth. Any change invalidates it.
+    float           MaxLineWidthFontSize;
+    int             MaxLineWidthFontAtlasBuildId;
+
+    ImGuiTextIndex()                                        { clear(); }
+    void            clear()                                 { LineOffsets.clear(); EndOffset = 0; MaxLineWidth = 0.0f; MaxLineWidthLines = 0; MaxLineWidthFont = NULL; MaxLineWidthFontSize = 0.0f; MaxLineWidthFontAtlasBuildId = 0; }
+    int             size() const                            { return LineOffsets.Size; }
+    const char*     get_line_begin(const char* base, int n) const { return base + LineOffsets[n]; }
+    const char*     get_line_end(const char* base, int n) const   { return base + (n + 1 < LineOffsets.Size ? (LineOffsets[n + 1] - 1) : EndOffset); }
+    IMGUI_API void  append(const char* base, int old_size, int new_size);
+    IMGUI_API float CalcMaxLineWidth(const char* base, ImFont* font, float font_size);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1150,6 +1352,24 @@ struct ImGuiWindowStackData
     ImGuiStackSizes         StackSizesOnBegin;      // Store size of various stacks for asserting
 };
 
+// Uniform grid over the hoverable windows rectangles, used by FindHoveredWindow() to only test windows overlapping the mouse cell.
+// Built in EndFrame() when there are enough windows, and only rebuilt when the display order, a rectangle or a visibility changed.
+struct ImGuiWindowHoverGrid
+{
+    ImVector<ImGuiWindow*>  Windows;                // Copy of g.Windows[] when built. Used to detect changes, and to validate entries (display order may change before FindHoveredWindow())
+    ImVector<ImRect>        Rects;                  // Hoverable rectangle (with padding) for each of Windows[], or an empty rectangle for windows that can't be hovered
+    ImVector<int>           CellsStart;             // Offset into CellsWindows[] for each cell, + end offset
+    ImVector<int>           CellsWindows;           // Indices into Windows[] overlapping each cell, sorted back to front
+    ImVec2                  Min;                    // Top-left corner of the grid
+    ImVec2                  InvCellSize;
+    int                     CellsX, CellsY;         // Grid dimensions. 0 when there's no grid
+    ImVec2                  PaddingRegular;         // Paddings used to build Rects[]
+    ImVec2                  PaddingForResize;
+
+    ImGuiWindowHoverGrid()  { Clear(); }
+    void Clear()            { Windows.clear(); Rects.clear(); CellsStart.clear(); CellsWindows.clear(); Min = InvCellSize = PaddingRegular = PaddingForResize = ImVec2(0.0f, 0.0f); CellsX = CellsY = 0; }
+};
+
 struct ImGuiShrinkWidthItem
 {
     int         Index;
@@ -1166,6 +1386,74 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Size of text size cache (number of entries, must be a power of two)
+#ifndef IMGUI_TEXT_SIZE_CACHE_SIZE
+#define IMGUI_TEXT_SIZE_CACHE_SIZE      4096
+#endif
+
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64       Hash;                   // 64-bit hash of text contents, font, font size and wrap width
+    ImVector<char> Text;                // Copy of text contents, compared on lookup so a hash collision can't return the size of another text. Capacity is reused when the entry is recycled.
+    ImFont*     Font;
+    int         FontAtlasBuildId;       // Entries from an older font atlas build are stale
+    float       FontSize;
+    float       WrapWidth;
+    int         LastFrameUsed;
+    ImVec2      Size;
+};
+
+// Bounded cache for CalcTextSize() results, enabled with io.ConfigTextSizeCache.
+// 2-way set associative: on a miss, the least recently used entry of the set is replaced. Entries are invalidated when their font atlas is rebuilt.
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;  // IMGUI_TEXT_SIZE_CACHE_SIZE entries, allocated on first use
+    int         HitsThisFrame, MissesThisFrame;
+    int         HitsLastFrame, MissesLastFrame;
+
+    ImGuiTextSizeCache()        { HitsThisFrame = MissesThisFrame = HitsLastFrame = MissesLastFrame = 0; }
+    void        Clear()         { Entries.clear_destruct(); }
+    IMGUI_API ImGuiTextSizeCacheEntry* GetEntry(const char* text, const char* text_end, ImFont* font, float font_size, float wrap_width, int frame_count, bool* out_hit);
+};
+
+// Minimum length of word-wrapped text to use the layout cache (shorter text is cheap enough to lay out every frame)
+#ifndef IMGUI_WRAPPED_TEXT_LAYOUT_MIN_LENGTH
+#define IMGUI_WRAPPED_TEXT_LAYOUT_MIN_LENGTH    128
+#endif
+
+// Number of frames after which unused layouts are discarded
+#ifndef IMGUI_WRAPPED_TEXT_LAYOUT_MAX_AGE
+#define IMGUI_WRAPPED_TEXT_LAYOUT_MAX_AGE       60
+#endif
+
+struct ImGuiWrappedTextLayout
+{
+    ImU64           Hash;                   // 64-bit hash of text contents, font, font size and wrap width
+    ImVector<char>  Text;                   // Copy of text contents, compared on lookup so a hash collision can't reuse the layout of another text
+    ImFont*         Font;
+    int             FontAtlasBuildId;       // Layouts from an older font atlas build are stale
+    float           FontSize;
+    float           WrapWidth;
+    int             LastFrameUsed;
+    ImVec2          Size;                   // Same as CalcTextSize() output
+    ImVector<int>   LineOffsets;            // Begin and end offset of each line (2 entries per line). Line N is at y = N * FontSize.
+
+    bool            MatchesKey(ImU64 hash, const char* text, int text_len, ImFont* font, float font_size, float wrap_width) const { return Hash == hash && Text.Size == text_len && Font == font && FontSize == font_size && WrapWidth == wrap_width && memcmp(Text.Data, text, (size_t)text_len) == 0; }
+};
+
+// Cache of line breaks for long word-wrapped text, enabled with io.ConfigWrappedTextLayoutCache.
+// Unchanged text is only laid out again when its wrap width, font or font size changes, and rendering can skip lines outside of the clipping rectangle.
+struct ImGuiWrappedTextLayoutCache
+{
+    ImVector<ImGuiWrappedTextLayout*> Layouts;
+    ImGuiStorage    Map;                    // (ImGuiID)Hash -> index in Layouts[]. On collision, only one of the layouts is in the map.
+
+    ~ImGuiWrappedTextLayoutCache()          { Clear(); }
+    IMGUI_API void  Clear();
+    IMGUI_API void  GarbageCollect(int frame_count);
+    IMGUI_API ImGuiWrappedTextLayout* GetLayout(const char* text, const char* text_end, ImFont* font, float font_size, float wrap_width, int frame_count);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Inputs support
 //-----------------------------------------------------------------------------
@@ -1564,6 +1852,120 @@ struct ImGuiStackTool
     ImGuiStackTool()        { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+#ifdef IMGUI_ENABLE_PROFILER
+
+// Number of frames kept by the profiler
+#ifndef IMGUI_PROFILER_FRAMES_COUNT
+#define IMGUI_PROFILER_FRAMES_COUNT     120
+#endif
+
+// Size of buffered output before it is written to the capture file, see ProfilerStartCapture()
+#ifndef IMGUI_PROFILER_CAPTURE_BUFFER_SIZE
+#define IMGUI_PROFILER_CAPTURE_BUFFER_SIZE  (256 * 1024)
+#endif
+
+// A timed zone, e.g. NewFrame(), or a window from Begin() to End()
+struct ImGuiProfilerZone
+{
+    const char*             Name;                       // Not copied: string literal, or ImGuiWindow::Name
+    ImGuiID                 WindowID;                   // Window of a Begin()/End() zone, 0 for other zones
+    int                     Depth;                      // Nesting level (0 for top-level zones)
+    ImU64                   TicksBegin;
+    ImU64                   TicksEnd;
+};
+
+// Zones recorded during one frame, from NewFrame() to the next NewFrame()
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;                 // g.FrameCount of the recorded frame, -1 if unused
+    ImU64                   TicksBegin;
+    ImU64                   TicksEnd;                   // 0 while recording
+    ImVector<ImGuiProfilerZone> Zones;                  // In begin order: a zone is followed by the zones nested in it
+
+    ImGuiProfilerFrame()    { FrameCount = -1; TicksBegin = TicksEnd = 0; }
+};
+
+// State for the built-in CPU profiler, see 'Metrics->Profiler'
+// Zones are recorded in a ring buffer of frames, reusing their memory. Ticks are read from QueryPerformanceCounter() or clock_gettime(CLOCK_MONOTONIC).
+struct ImGuiProfiler
+{
+    bool                    Paused;                     // Stop recording frames (e.g. to inspect them)
+    bool                    Recording;                  // Recording the current frame
+    ImU64                   TicksPerSecond;
+    ImGuiProfilerFrame      Frames[IMGUI_PROFILER_FRAMES_COUNT];
+    int                     FrameIdx;                   // Index of the last frame in Frames[] (being recorded if Recording == true)
+    ImVector<int>           ZonesStack;                 // Indices of open zones in Frames[FrameIdx].Zones[]
+    ImFileHandle            CaptureFile;                // Completed frames are streamed to this file while != NULL, see ProfilerStartCapture()
+    ImGuiTextBuffer         CaptureBuf;                 // Output pending to be written to CaptureFile
+    ImU64                   CaptureTicksBase;           // Ticks of the first captured frame, trace timestamps are relative to it
+    int                     CaptureFramesCount;
+    bool                    CaptureFailed;              // Last capture was stopped because writing to CaptureFile failed (e.g. disk full), the file is incomplete
+    int                     DisplayFrameOffset;         // [Metrics] Frame to display, 0 = last completed frame
+    float                   DisplayZoom;                // [Metrics] Timeline horizontal zoom
+    char                    DisplayTraceFilename[64];   // [Metrics] Output file for export/capture buttons
+
+    ImGuiProfiler()         { Paused = Recording = false; TicksPerSecond = 0; FrameIdx = 0; CaptureFile = NULL; CaptureTicksBase = 0; CaptureFramesCount = 0; CaptureFailed = false; DisplayFrameOffset = 0; DisplayZoom = 1.0f; ImStrncpy(DisplayTraceFilename, "imgui_trace.json", IM_ARRAYSIZE(DisplayTraceFilename)); }
+    void                    Clear()                     { for (int n = 0; n < IMGUI_PROFILER_FRAMES_COUNT; n++) { Frames[n].FrameCount = -1; Frames[n].Zones.clear(); } ZonesStack.clear(); Recording = false; }
+    IMGUI_API ImGuiProfilerFrame* GetCompletedFrame(int n);     // n = 0 for last completed frame, NULL if not available
+};
+
+// Helper to end a zone with the current scope, see IMGUI_PROFILER_SCOPE()
+struct IMGUI_API ImGuiProfilerScope
+{
+    ImGuiProfilerScope(const char* name);
+    ~ImGuiProfilerScope();
+};
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+
+// Subsystems allocations are accounted to, see IMGUI_MEM_TAG_SCOPE()
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Other,          // Anything not covered below (context, ID stacks, popups, navigation, user calls to IM_ALLOC() etc.)
+    ImGuiMemTag_Windows,        // ImGuiWindow and allocations within Begin()/End(), ImGuiStorage (e.g. tree nodes open state)
+    ImGuiMemTag_DrawLists,      // ImDrawList buffers, draw lists splitter channels, draw data
+    ImGuiMemTag_Tables,         // ImGuiTable and allocations within BeginTable()/EndTable()
+    ImGuiMemTag_Fonts,          // ImFontAtlas, ImFont, atlas build and texture data
+    ImGuiMemTag_InputText,      // InputText() state and buffers
+    ImGuiMemTag_Settings,       // .ini settings, in memory and loading/saving
+    ImGuiMemTag_Logging,        // LogToXXX() and Debug Log buffers
+    ImGuiMemTag_COUNT
+};
+
+// Allocation counters for one ImGuiMemTag, see GetAllocatorStats()
+struct ImGuiMemTagStats
+{
+    size_t                  BytesCurrent;               // Size of active allocations (as requested, not counting the tracking header)
+    size_t                  BytesPeak;                  // Highest value of BytesCurrent so far
+    int                     AllocsCurrent;              // Number of active allocations
+    int                     AllocsTotal;                // Number of allocations so far
+    int                     AllocsThisFrame;            // Number of allocations since the last NewFrame()
+    int                     AllocsLastFrame;            // Number of allocations during the last frame (from NewFrame() to the next NewFrame())
+
+    ImGuiMemTagStats()      { memset(this, 0, sizeof(*this)); }
+};
+
+// Allocation counters, shared by all contexts like the allocator functions. See 'Metrics->Memory'.
+// Every allocation is prefixed with a small header storing its size and tag, so MemFree() can account for it.
+// Counters are updated atomically and the current tag is per thread, so allocations made from any thread are accounted for.
+struct ImGuiMemStats
+{
+    ImGuiMemTagStats        Tags[ImGuiMemTag_COUNT];
+    ImGuiMemTagStats        Total;                      // All tags (Total.BytesPeak is the actual peak, which is lower or equal to the sum of peaks)
+};
+
+// Helper to set the allocation tag of the current thread until the end of the current scope, see IMGUI_MEM_TAG_SCOPE()
+struct IMGUI_API ImGuiMemTagScope
+{
+    ImGuiMemTag             BackupTag;
+    ImGuiMemTagScope(ImGuiMemTag tag);
+    ~ImGuiMemTagScope();
+};
+
+#endif // #ifdef IMGUI_ENABLE_MEMORY_TRACKING
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -1613,6 +2015,9 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImVector<ImGuiWindow*>  WindowsSortBeginOrder;              // Windows in submission order during the last EndFrame() sort
+    bool                    WindowsSortDirty;                   // Set when display order, submission order or hierarchy changed since the last EndFrame() sort
+    ImGuiWindowHoverGrid    WindowsHoverGrid;                   // Spatial index of windows used by FindHoveredWindow() when there are many windows
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -1835,21 +2240,30 @@ struct ImGuiContext
     // Debug Tools
     ImGuiDebugLogFlags      DebugLogFlags;
     ImGuiTextBuffer         DebugLogBuf;
+    ImGuiTextIndex          DebugLogIndex;
     bool                    DebugItemPickerActive;              // Item picker is active (started with DebugStartItemPicker())
     ImU8                    DebugItemPickerMouseButton;
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiStackTool          DebugStackTool;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
     int                     FramerateSecPerFrameIdx;
     int                     FramerateSecPerFrameCount;
     float                   FramerateSecPerFrameAccum;
+    ImGuiFrameStats         FrameStats;                         // Last frame statistics, see GetFrameStats()
+    ImGuiFrameStats         FrameStatsCurrent;                  // Statistics being accumulated for the current frame
+    ImU64                   FrameStatsPhaseTicks;               // Time of the beginning of the current phase (NewFrame(), user code, EndFrame(), Render())
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImGuiTextSizeCache      TextSizeCache;                      // Cache for CalcTextSize() results (enabled with io.ConfigTextSizeCache)
+    ImGuiWrappedTextLayoutCache WrappedTextLayoutCache;         // Cache for line breaks of long word-wrapped text (enabled with io.ConfigWrappedTextLayoutCache)
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
@@ -1866,6 +2280,7 @@ struct ImGuiContext
         TestEngineHookItems = false;
         TestEngine = NULL;
 
+        WindowsSortDirty = false;
         WindowsActiveCount = 0;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
@@ -2001,6 +2416,7 @@ struct ImGuiContext
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
         FramerateSecPerFrameAccum = 0.0f;
+        FrameStatsPhaseTicks = 0;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
     }
 };
@@ -2163,6 +2579,7 @@ public:
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
+    ImGuiID     GetID(const ImGuiLabelLiteral& label);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
 
     // We don't use g.FontSize because the window may be != g.CurrentWindow.
@@ -2812,6 +3229,8 @@ namespace ImGui
     // NB: All position are in absolute pixels coordinates (we are never using window coordinates internally)
     IMGUI_API void          RenderText(ImVec2 pos, const char* text, const char* text_end = NULL, bool hide_text_after_hash = true);
     IMGUI_API void          RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end, float wrap_width);
+    IMGUI_API void          RenderTextWrappedLayout(ImVec2 pos, const char* text, const ImGuiWrappedTextLayout* layout);
+    IMGUI_API ImGuiWrappedTextLayout* GetWrappedTextLayout(const char* text, const char* text_end, float wrap_width); // Return NULL if disabled or text is too short
     IMGUI_API void          RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, float clip_max_x, float ellipsis_max_x, const char* text, const char* text_end, const ImVec2* text_size_if_known);
@@ -2832,7 +3251,11 @@ namespace ImGui
 
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
+    IMGUI_API void          TextIndexed(const char* text_base, ImGuiTextIndex* index, ImGuiTextFlags flags = 0);
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(const char* label, const char* label_end, const ImVec2& size_arg, ImGuiButtonFlags flags);
+    IMGUI_API bool          ButtonEx(ImGuiID id, const char* label, const char* label_end, const ImVec2& size_arg, ImGuiButtonFlags flags);
+    IMGUI_API bool          CheckboxEx(ImGuiID id, const char* label, bool* v);
     IMGUI_API bool          CloseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          CollapseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
@@ -2899,6 +3322,22 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
 
+#ifdef IMGUI_ENABLE_PROFILER
+    // Profiler (use IMGUI_PROFILER_XXX macros so markers are compiled out when IMGUI_ENABLE_PROFILER is not defined)
+    IMGUI_API void          ProfilerNewFrame();
+    IMGUI_API void          ProfilerZoneBegin(const char* name, ImGuiID window_id = 0);
+    IMGUI_API void          ProfilerZoneEnd();
+    IMGUI_API bool          ProfilerExportTrace(const char* filename);      // Write frames currently held by the profiler as Chrome Trace Event JSON (chrome://tracing, Perfetto)
+    IMGUI_API bool          ProfilerStartCapture(const char* filename);     // Write every following frame as Chrome Trace Event JSON, until ProfilerStopCapture()
+    IMGUI_API bool          ProfilerStopCapture();                          // Return false if writing the capture file failed (capture is then already stopped, see ImGuiProfiler::CaptureFailed)
+#endif
+
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    // Memory tracking (use IMGUI_MEM_TAG_SCOPE() so tags are compiled out when IMGUI_ENABLE_MEMORY_TRACKING is not defined)
+    IMGUI_API ImGuiMemStats GetAllocatorStats();                           // Snapshot of allocation counters
+    IMGUI_API const char*   GetMemTagName(ImGuiMemTag tag);
+#endif
+
     // Debug Log
     IMGUI_API void          DebugLog(const char* fmt, ...) IM_FMTARGS(1);
     IMGUI_API void          DebugLogV(const char* fmt, va_list args) IM_FMTLIST(1);
@@ -2925,6 +3364,12 @@ namespace ImGui
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
     IMGUI_API void          DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int windows_size, ImGuiWindow* parent_in_begin_stack);
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    IMGUI_API void          DebugNodeMemoryStats(const ImGuiMemStats* stats);
+#endif
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
     // Obsolete functions
@@ -2960,6 +3405,7 @@ IMGUI_API const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype();
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API void      ImFontAtlasBuildPackGlyphRects(ImFontAtlas* atlas, void* stbrp_rects_opaque, int rects_count, int glyphs_surface);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
@@ -310,6 +310,7 @@ bool    ImGui::BeginTable(const char* str_id, int columns_count, ImGuiTableFlags
 bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
         return false;
@@ -716,7 +717,9 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     IM_ASSERT(table->IsLayoutLocked == false);
+    IMGUI_PROFILER_SCOPE("TableUpdateLayout");
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
@@ -1192,6 +1195,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 void    ImGui::EndTable()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
 
@@ -2760,6 +2764,7 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
 
 void ImGui::TableSortSpecsBuild(ImGuiTable* table)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     bool dirty = table->IsSortSpecsDirty;
     if (dirty)
     {
@@ -3178,6 +3183,7 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
     return settings;
@@ -133,6 +133,7 @@ static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const
 // [SECTION] Widgets: Text, etc.
 //-------------------------------------------------------------------------
 // - TextEx() [Internal]
+// - TextIndexed() [Internal]
 // - TextUnformatted()
 // - Text()
 // - TextV()
@@ -171,7 +172,8 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
     {
         // Common case
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
-        const ImVec2 text_size = CalcTextSize(text_begin, text_end, false, wrap_width);
+        const ImGuiWrappedTextLayout* wrap_layout = wrap_enabled ? GetWrappedTextLayout(text_begin, text_end, wrap_width) : NULL; // Cached line breaks for long wrapped text
+        const ImVec2 text_size = wrap_layout ? wrap_layout->Size : CalcTextSize(text_begin, text_end, false, wrap_width);
 
         ImRect bb(text_pos, text_pos + text_size);
         ItemSize(text_size, 0.0f);
@@ -179,7 +181,10 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
             return;
 
         // Render (we don't hide text after ## in this end-user function)
-        RenderTextWrapped(bb.Min, text_begin, text_end, wrap_width);
+        if (wrap_layout)
+            RenderTextWrappedLayout(bb.Min, text_begin, wrap_layout);
+        else
+            RenderTextWrapped(bb.Min, text_begin, text_end, wrap_width);
     }
     else
     {
@@ -256,6 +261,32 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
     }
 }
 
+// Display a large text buffer using a line index maintained by the caller (e.g. with ImGuiTextIndex::append() every time text is added).
+// Unlike the "long text" path of TextEx(), cost is O(visible lines) regardless of scrolling position: we use the clipper to only submit
+// visible lines, and the width of the widest line is cached in the index (disable with ImGuiTextFlags_NoWidthForLargeClippedText).
+void ImGui::TextIndexed(const char* text_base, ImGuiTextIndex* index, ImGuiTextFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+    ImGuiContext& g = *GImGui;
+
+    const float start_x = window->DC.CursorPos.x;
+    const float max_width = (flags & ImGuiTextFlags_NoWidthForLargeClippedText) ? 0.0f : index->CalcMaxLineWidth(text_base, g.Font, g.FontSize);
+
+    PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(g.Style.ItemSpacing.x, 0.0f));
+    ImGuiListClipper clipper;
+    clipper.Begin(index->size(), g.FontSize);
+    while (clipper.Step())
+        for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
+            TextEx(index->get_line_begin(text_base, line_no), index->get_line_end(text_base, line_no), ImGuiTextFlags_NoWidthForLargeClippedText);
+    clipper.End();
+    PopStyleVar();
+
+    // Report width of widest line, including the clipped ones
+    window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, start_x + max_width);
+}
+
 void ImGui::TextUnformatted(const char* text, const char* text_end)
 {
     TextEx(text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
@@ -680,6 +711,21 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
 }
 
 bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    return ButtonEx(label, NULL, size_arg, flags);
+}
+
+// 'label_end' == NULL: zero-terminated label
+bool ImGui::ButtonEx(const char* label, const char* label_end, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label, label_end), label, label_end, size_arg, flags);
+}
+
+// Button with an ID computed by the caller (e.g. from a ImGuiLabelLiteral)
+bool ImGui::ButtonEx(ImGuiID id, const char* label, const char* label_end, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -687,8 +733,7 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcTextSize(label, label_end, true);
 
     ImVec2 pos = window->DC.CursorPos;
     if ((flags & ImGuiButtonFlags_AlignTextBaseLine) && style.FramePadding.y < window->DC.CurrLineTextBaseOffset) // Try to vertically align buttons that are smaller/have no padding so that text baseline matches (bit hacky, since it shouldn't be a flag)
@@ -713,7 +758,7 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     if (g.LogEnabled)
         LogSetNextTextDecoration("[", "]");
-    RenderTextClipped(bb.Min + style.FramePadding, bb.Max - style.FramePadding, label, NULL, &label_size, style.ButtonTextAlign, &bb);
+    RenderTextClipped(bb.Min + style.FramePadding, bb.Max - style.FramePadding, label, label_end, &label_size, style.ButtonTextAlign, &bb);
 
     // Automatically close popups
     //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
@@ -728,6 +773,19 @@ bool ImGui::Button(const char* label, const ImVec2& size_arg)
     return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
 }
 
+bool ImGui::Button(const char* label, const char* label_end, const ImVec2& size_arg)
+{
+    return ButtonEx(label, label_end, size_arg, ImGuiButtonFlags_None);
+}
+
+bool ImGui::Button(const ImGuiLabelLiteral& label, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label.Label, NULL, size_arg, ImGuiButtonFlags_None);
+}
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(const char* label)
 {
@@ -1102,6 +1160,23 @@ bool ImGui::ImageButton(ImTextureID user_texture_id, const ImVec2& size, const I
 #endif // #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 
 bool ImGui::Checkbox(const char* label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(window->GetID(label), label, v);
+}
+
+bool ImGui::Checkbox(const ImGuiLabelLiteral& label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(window->GetID(label), label.Label, v);
+}
+
+// Checkbox with an ID computed by the caller (e.g. from a ImGuiLabelLiteral)
+bool ImGui::CheckboxEx(ImGuiID id, const char* label, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1109,7 +1184,6 @@ bool ImGui::Checkbox(const char* label, bool* v)
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     const float square_sz = GetFrameHeight();
@@ -1532,13 +1606,11 @@ bool ImGui::SplitterBehavior(const ImRect& bb, ImGuiID id, ImGuiAxis axis, float
     return held;
 }
 
-static int IMGUI_CDECL ShrinkWidthItemComparer(const void* lhs, const void* rhs)
+static bool ShrinkWidthItemLess(const ImGuiShrinkWidthItem& a, const ImGuiShrinkWidthItem& b)
 {
-    const ImGuiShrinkWidthItem* a = (const ImGuiShrinkWidthItem*)lhs;
-    const ImGuiShrinkWidthItem* b = (const ImGuiShrinkWidthItem*)rhs;
-    if (int d = (int)(b->Width - a->Width))
-        return d;
-    return (b->Index - a->Index);
+    if (int d = (int)(b.Width - a.Width))
+        return d < 0;
+    return b.Index < a.Index;
 }
 
 // Shrink excess width from a set of item, by removing width from the larger items first.
@@ -1551,7 +1623,7 @@ void ImGui::ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_exc
             items[0].Width = ImMax(items[0].Width - width_excess, 1.0f);
         return;
     }
-    ImQsort(items, (size_t)count, sizeof(ImGuiShrinkWidthItem), ShrinkWidthItemComparer);
+    ImSort<ImGuiShrinkWidthItem, ShrinkWidthItemLess>(items, count);
     int count_same_width = 1;
     while (width_excess > 0.0f && count_same_width < count)
     {
@@ -4022,6 +4094,7 @@ static void InputTextReconcileUndoStateAfterUserCallback(ImGuiInputTextState* st
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_InputText);
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -5878,6 +5951,14 @@ bool ImGui::TreeNode(const char* label)
     return TreeNodeBehavior(window->GetID(label), 0, label, NULL);
 }
 
+bool ImGui::TreeNode(const ImGuiLabelLiteral& label)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return TreeNodeBehavior(window->GetID(label), 0, label.Label, NULL);
+}
+
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
 {
     return TreeNodeExV(str_id, 0, fmt, args);
@@ -5897,6 +5978,15 @@ bool ImGui::TreeNodeEx(const char* label, ImGuiTreeNodeFlags flags)
     return TreeNodeBehavior(window->GetID(label), flags, label, NULL);
 }
 
+bool ImGui::TreeNodeEx(const char* label, const char* label_end, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    return TreeNodeBehavior(window->GetID(label, label_end), flags, label, FindRenderedTextEnd(label, label_end));
+}
+
 bool ImGui::TreeNodeEx(const char* str_id, ImGuiTreeNodeFlags flags, const char* fmt, ...)
 {
     va_list args;
@@ -6301,6 +6391,12 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
 // With this scheme, ImGuiSelectableFlags_SpanAllColumns and ImGuiSelectableFlags_AllowItemOverlap are also frequently used flags.
 // FIXME: Selectable() with (size.x == 0.0f) and (SelectableTextAlign.x > 0.0f) followed by SameLine() is currently not supported.
 bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    return Selectable(label, NULL, selected, flags, size_arg);
+}
+
+// 'label_end' == NULL: zero-terminated label
+bool ImGui::Selectable(const char* label, const char* label_end, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -6310,8 +6406,8 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     const ImGuiStyle& style = g.Style;
 
     // Submit label or explicit size to ItemSize(), whereas ItemAdd() will submit a larger/spanning rectangle.
-    ImGuiID id = window->GetID(label);
-    ImVec2 label_size = CalcTextSize(label, NULL, true);
+    ImGuiID id = window->GetID(label, label_end);
+    ImVec2 label_size = CalcTextSize(label, label_end, true);
     ImVec2 size(size_arg.x != 0.0f ? size_arg.x : label_size.x, size_arg.y != 0.0f ? size_arg.y : label_size.y);
     ImVec2 pos = window->DC.CursorPos;
     pos.y += window->DC.CurrLineTextBaseOffset;
@@ -6432,7 +6528,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     else if (span_all_columns && g.CurrentTable)
         TablePopBackgroundChannel();
 
-    RenderTextClipped(text_min, text_max, label, NULL, &label_size, style.SelectableTextAlign, &bb);
+    RenderTextClipped(text_min, text_max, label, label_end, &label_size, style.SelectableTextAlign, &bb);
 
     // Automatically close popups
     if (pressed && (window->Flags & ImGuiWindowFlags_Popup) && !(flags & ImGuiSelectableFlags_DontClosePopups) && !(g.LastItemData.InFlags & ImGuiItemFlags_SelectableDontClosePopup))
@@ -6455,6 +6551,16 @@ bool ImGui::Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags
     return false;
 }
 
+bool ImGui::Selectable(const char* label, const char* label_end, bool* p_selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    if (Selectable(label, label_end, *p_selected, flags, size_arg))
+    {
+        *p_selected = !*p_selected;
+        return true;
+    }
+    return false;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ListBox
 //-------------------------------------------------------------------------
@@ -7353,22 +7459,18 @@ static inline int TabItemGetSectionIdx(const ImGuiTabItem* tab)
     return (tab->Flags & ImGuiTabItemFlags_Leading) ? 0 : (tab->Flags & ImGuiTabItemFlags_Trailing) ? 2 : 1;
 }
 
-static int IMGUI_CDECL TabItemComparerBySection(const void* lhs, const void* rhs)
+static bool TabItemLessBySection(const ImGuiTabItem& a, const ImGuiTabItem& b)
 {
-    const ImGuiTabItem* a = (const ImGuiTabItem*)lhs;
-    const ImGuiTabItem* b = (const ImGuiTabItem*)rhs;
-    const int a_section = TabItemGetSectionIdx(a);
-    const int b_section = TabItemGetSectionIdx(b);
+    const int a_section = TabItemGetSectionIdx(&a);
+    const int b_section = TabItemGetSectionIdx(&b);
     if (a_section != b_section)
-        return a_section - b_section;
-    return (int)(a->IndexDuringLayout - b->IndexDuringLayout);
+        return a_section < b_section;
+    return a.IndexDuringLayout < b.IndexDuringLayout;
 }
 
-static int IMGUI_CDECL TabItemComparerByBeginOrder(const void* lhs, const void* rhs)
+static bool TabItemLessByBeginOrder(const ImGuiTabItem& a, const ImGuiTabItem& b)
 {
-    const ImGuiTabItem* a = (const ImGuiTabItem*)lhs;
-    const ImGuiTabItem* b = (const ImGuiTabItem*)rhs;
-    return (int)(a->BeginOrder - b->BeginOrder);
+    return a.BeginOrder < b.BeginOrder;
 }
 
 static ImGuiTabBar* GetTabBarFromTabBarRef(const ImGuiPtrOrIndex& ref)
@@ -7424,7 +7526,7 @@ bool    ImGui::BeginTabBarEx(ImGuiTabBar* tab_bar, const ImRect& tab_bar_bb, ImG
 
     // Ensure correct ordering when toggling ImGuiTabBarFlags_Reorderable flag, or when a new tab was added while being not reorderable
     if ((flags & ImGuiTabBarFlags_Reorderable) != (tab_bar->Flags & ImGuiTabBarFlags_Reorderable) || (tab_bar->TabsAddedNew && !(flags & ImGuiTabBarFlags_Reorderable)))
-        ImQsort(tab_bar->Tabs.Data, tab_bar->Tabs.Size, sizeof(ImGuiTabItem), TabItemComparerByBeginOrder);
+        ImSort<ImGuiTabItem, TabItemLessByBeginOrder>(tab_bar->Tabs.Data, tab_bar->Tabs.Size);
     tab_bar->TabsAddedNew = false;
 
     // Flags
@@ -7544,7 +7646,7 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
         tab_bar->Tabs.resize(tab_dst_n);
 
     if (need_sort_by_section)
-        ImQsort(tab_bar->Tabs.Data, tab_bar->Tabs.Size, sizeof(ImGuiTabItem), TabItemComparerBySection);
+        ImSort<ImGuiTabItem, TabItemLessBySection>(tab_bar->Tabs.Data, tab_bar->Tabs.Size);
 
     // Calculate spacing between sections
     sections[0].Spacing = sections[0].TabCount > 0 && (sections[1].TabCount + sections[2].TabCount) > 0 ? g.Style.ItemInnerSpacing.x : 0.0f;
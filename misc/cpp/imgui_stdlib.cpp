@@ -3,6 +3,7 @@
 
 // Changelog:
 // - v0.10: Initial version. Added InputText() / InputTextMultiline() calls with std::string
+// - v0.11: Added TextUnformatted(), Button(), Selectable(), TreeNode(), TreeNodeEx(), PushID(), GetID() calls with std::string_view, when IMGUI_STDLIB_ENABLE_STRING_VIEW is defined (requires C++17)
 
 #include "imgui.h"
 #include "imgui_stdlib.h"
@@ -70,3 +71,62 @@ bool ImGui::InputTextWithHint(const char* label, const char* hint, std::string*
     cb_user_data.ChainCallbackUserData = user_data;
     return InputTextWithHint(label, hint, (char*)str->c_str(), str->capacity() + 1, flags, InputTextCallback, &cb_user_data);
 }
+
+#ifdef IMGUI_STDLIB_ENABLE_STRING_VIEW
+
+// A default-constructed std::string_view has a NULL data() pointer, while dear imgui treats a NULL end pointer as "zero-terminated".
+// Always pass a valid [begin, end) range: an empty view becomes an empty range, which doesn't read the string.
+static const char* StringViewBegin(std::string_view str)
+{
+    return str.data() ? str.data() : "";
+}
+
+void ImGui::TextUnformatted(std::string_view text)
+{
+    const char* text_begin = StringViewBegin(text);
+    TextUnformatted(text_begin, text_begin + text.size());
+}
+
+bool ImGui::Button(std::string_view label, const ImVec2& size)
+{
+    const char* label_begin = StringViewBegin(label);
+    return Button(label_begin, label_begin + label.size(), size);
+}
+
+bool ImGui::Selectable(std::string_view label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size)
+{
+    const char* label_begin = StringViewBegin(label);
+    return Selectable(label_begin, label_begin + label.size(), selected, flags, size);
+}
+
+bool ImGui::Selectable(std::string_view label, bool* p_selected, ImGuiSelectableFlags flags, const ImVec2& size)
+{
+    const char* label_begin = StringViewBegin(label);
+    return Selectable(label_begin, label_begin + label.size(), p_selected, flags, size);
+}
+
+bool ImGui::TreeNode(std::string_view label)
+{
+    const char* label_begin = StringViewBegin(label);
+    return TreeNodeEx(label_begin, label_begin + label.size(), 0);
+}
+
+bool ImGui::TreeNodeEx(std::string_view label, ImGuiTreeNodeFlags flags)
+{
+    const char* label_begin = StringViewBegin(label);
+    return TreeNodeEx(label_begin, label_begin + label.size(), flags);
+}
+
+void ImGui::PushID(std::string_view str_id)
+{
+    const char* str_id_begin = StringViewBegin(str_id);
+    PushID(str_id_begin, str_id_begin + str_id.size());
+}
+
+ImGuiID ImGui::GetID(std::string_view str_id)
+{
+    const char* str_id_begin = StringViewBegin(str_id);
+    return GetID(str_id_begin, str_id_begin + str_id.size());
+}
+
+#endif // #ifdef IMGUI_STDLIB_ENABLE_STRING_VIEW
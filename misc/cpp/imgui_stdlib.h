@@ -3,10 +3,14 @@
 
 // Changelog:
 // - v0.10: Initial version. Added InputText() / InputTextMultiline() calls with std::string
+// - v0.11: Added TextUnformatted(), Button(), Selectable(), TreeNode(), TreeNodeEx(), PushID(), GetID() calls with std::string_view, when IMGUI_STDLIB_ENABLE_STRING_VIEW is defined (requires C++17)
 
 #pragma once
 
 #include <string>
+#ifdef IMGUI_STDLIB_ENABLE_STRING_VIEW
+#include <string_view>
+#endif
 
 namespace ImGui
 {
@@ -16,3 +20,20 @@ namespace ImGui
     IMGUI_API bool  InputTextMultiline(const char* label, std::string* str, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool  InputTextWithHint(const char* label, const char* hint, std::string* str, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
 }
+
+#ifdef IMGUI_STDLIB_ENABLE_STRING_VIEW
+namespace ImGui
+{
+    // Calls with std::string_view
+    // The string doesn't need to be zero-terminated and its length is passed along, saving the strlen() of the 'const char*' versions.
+    // Labels follow the same rules as other labels, e.g. "Label##id" is displayed as "Label".
+    IMGUI_API void      TextUnformatted(std::string_view text);
+    IMGUI_API bool      Button(std::string_view label, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool      Selectable(std::string_view label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool      Selectable(std::string_view label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool      TreeNode(std::string_view label);
+    IMGUI_API bool      TreeNodeEx(std::string_view label, ImGuiTreeNodeFlags flags = 0);
+    IMGUI_API void      PushID(std::string_view str_id);
+    IMGUI_API ImGuiID   GetID(std::string_view str_id);
+}
+#endif
@@ -0,0 +1,571 @@
+// dear imgui: viewer for large text files (e.g. multi-GB logs)
+// (code using C++11 standard library threads, and POSIX or Win32 file I/O)
+
+// Changelog:
+// - v0.10: Initial version.
+
+// See imgui_file_viewer.h for usage and notes.
+
+#include "imgui.h"
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+#include "imgui_file_viewer.h"
+#include <stdlib.h>     // malloc, free
+#include <string.h>     // memchr
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>      // open
+#include <sys/stat.h>   // fstat, stat
+#include <unistd.h>     // pread, close
+#endif
+
+//-------------------------------------------------------------------------
+// Data
+//-------------------------------------------------------------------------
+
+struct ImGuiFileViewerData
+{
+    // File (main thread only, except FileSize which is read by the indexing thread while it runs)
+#ifdef _WIN32
+    HANDLE                  FileHandle;
+#else
+    int                     FileDesc;
+#endif
+    ImU64                   FileId[2];              // Identity of the opened file (device/volume and inode/file index), to detect the file being replaced
+    ImU64                   FileSize;               // Size of the file when it was last checked. Lines are displayed and indexed up to that size.
+    ImVector<char>          Filename;
+
+    // Line index (written by indexing thread, protected by Mutex)
+    // - Start offsets of lines are stored in fixed-size blocks, so adding lines never needs to reallocate and copy the whole index while holding the lock.
+    // - Memory touched by the indexing thread is allocated with the C runtime and not IM_ALLOC(), which updates non-atomic counters in the ImGui context.
+    // - A hash of the last indexed bytes is stored along the index, to detect the file being truncated and written again past IndexedBytes.
+    std::mutex              Mutex;
+    std::vector<ImU64*>     LineOffsetsBlocks;      // Start offset of each line found so far, IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE per block. First one is always 0.
+    int                     LinesIndexed;           // Number of line start offsets in LineOffsetsBlocks[]
+    ImU64                   IndexedBytes;           // Bytes [0..IndexedBytes) have been indexed
+    ImU64                   FingerprintOffset;      // Bytes [FingerprintOffset..IndexedBytes) were hashed into FingerprintHash
+    ImGuiID                 FingerprintHash;
+    std::thread             Thread;
+    std::atomic<bool>       ThreadStop;
+
+    // Display (main thread only)
+    ImVector<char>          ReadBuf;                // Bytes [ReadBufOffset..ReadBufOffset+ReadBufSize) of the file, as last read for display
+    ImU64                   ReadBufOffset;
+    ImU64                   ReadBufSize;
+    float                   MaxLineWidth;           // Width of widest line displayed so far
+    double                  LastTailCheckTime;
+
+    ImGuiFileViewerData()
+    {
+#ifdef _WIN32
+        FileHandle = NULL;
+#else
+        FileDesc = -1;
+#endif
+        FileId[0] = FileId[1] = 0;
+        FileSize = IndexedBytes = FingerprintOffset = 0;
+        FingerprintHash = 0;
+        LinesIndexed = 0;
+        ThreadStop = false;
+        ReadBufOffset = ReadBufSize = 0;
+        MaxLineWidth = 0.0f;
+        LastTailCheckTime = 0.0;
+    }
+    ~ImGuiFileViewerData()
+    {
+        for (ImU64* block : LineOffsetsBlocks)
+            free(block);
+    }
+    ImU64   GetLineOffset(int n) const  { IM_ASSERT(n < LinesIndexed); return LineOffsetsBlocks[(size_t)(n / IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE)][n % IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE]; }
+    ImU64   GetLastLineOffset() const   { return GetLineOffset(LinesIndexed - 1); }
+    void    AddLineOffsets(const ImU64* offsets, int count)
+    {
+        while (count > 0)
+        {
+            const int block_offset = LinesIndexed % IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE;
+            if (block_offset == 0 && LinesIndexed / IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE == (int)LineOffsetsBlocks.size())
+                LineOffsetsBlocks.push_back((ImU64*)malloc(sizeof(ImU64) * IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE));
+            const int n = ImMin(count, IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE - block_offset);
+            memcpy(LineOffsetsBlocks[(size_t)(LinesIndexed / IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE)] + block_offset, offsets, sizeof(ImU64) * (size_t)n);
+            LinesIndexed += n;
+            offsets += n;
+            count -= n;
+        }
+    }
+};
+
+//-------------------------------------------------------------------------
+// File access
+//-------------------------------------------------------------------------
+
+static bool FileViewerOpenFile(ImGuiFileViewerData* data, const char* filename)
+{
+#ifdef _WIN32
+    data->FileHandle = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (data->FileHandle == INVALID_HANDLE_VALUE)
+    {
+        data->FileHandle = NULL;
+        return false;
+    }
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!::GetFileInformationByHandle(data->FileHandle, &info))
+        return false;
+    data->FileId[0] = info.dwVolumeSerialNumber;
+    data->FileId[1] = ((ImU64)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+#else
+    data->FileDesc = open(filename, O_RDONLY);
+    if (data->FileDesc < 0)
+        return false;
+    struct stat st;
+    if (fstat(data->FileDesc, &st) != 0)
+        return false;
+    data->FileId[0] = (ImU64)st.st_dev;
+    data->FileId[1] = (ImU64)st.st_ino;
+#endif
+    return true;
+}
+
+static void FileViewerCloseFile(ImGuiFileViewerData* data)
+{
+#ifdef _WIN32
+    if (data->FileHandle)
+        ::CloseHandle(data->FileHandle);
+    data->FileHandle = NULL;
+#else
+    if (data->FileDesc >= 0)
+        close(data->FileDesc);
+    data->FileDesc = -1;
+#endif
+}
+
+static ImU64 FileViewerGetFileSize(ImGuiFileViewerData* data)
+{
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(data->FileHandle, &size))
+        return 0;
+    return (ImU64)size.QuadPart;
+#else
+    struct stat st;
+    if (fstat(data->FileDesc, &st) != 0)
+        return 0;
+    return (ImU64)st.st_size;
+#endif
+}
+
+// Return true if 'filename' still designates the file we have opened. Return true as well if it cannot be checked (e.g. file temporarily missing during a log rotation).
+static bool FileViewerIsSameFile(ImGuiFileViewerData* data)
+{
+#ifdef _WIN32
+    HANDLE handle = ::CreateFileA(data->Filename.Data, 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+        return true;
+    BY_HANDLE_FILE_INFORMATION info;
+    const bool ok = ::GetFileInformationByHandle(handle, &info) != 0;
+    ::CloseHandle(handle);
+    return !ok || (data->FileId[0] == info.dwVolumeSerialNumber && data->FileId[1] == (((ImU64)info.nFileIndexHigh << 32) | info.nFileIndexLow));
+#else
+    struct stat st;
+    if (stat(data->Filename.Data, &st) != 0)
+        return true;
+    return data->FileId[0] == (ImU64)st.st_dev && data->FileId[1] == (ImU64)st.st_ino;
+#endif
+}
+
+// Read 'size' bytes at 'offset' into 'dst'. Return number of bytes read, which is smaller than 'size' if the file was truncated meanwhile.
+// Thread-safe: doesn't use or modify the file position.
+static ImU64 FileViewerReadFile(ImGuiFileViewerData* data, ImU64 offset, char* dst, ImU64 size)
+{
+    ImU64 total = 0;
+    while (total < size)
+    {
+        const ImU64 request_size = ImMin(size - total, (ImU64)(1u << 30));
+#ifdef _WIN32
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = (DWORD)((offset + total) & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)((offset + total) >> 32);
+        DWORD read_size = 0;
+        if (!::ReadFile(data->FileHandle, dst + total, (DWORD)request_size, &read_size, &overlapped) || read_size == 0)
+            break;
+#else
+        const ssize_t read_size = pread(data->FileDesc, dst + total, (size_t)request_size, (off_t)(offset + total));
+        if (read_size <= 0)
+            break;
+#endif
+        total += (ImU64)read_size;
+    }
+    return total;
+}
+
+// Return a pointer to file contents at 'offset', with at least 'size' bytes available (less if reaching end of file).
+// Main thread only. The pointer is only valid until the next call.
+static const char* FileViewerFetch(ImGuiFileViewerData* data, ImU64 offset, ImU64 size, ImU64* out_available)
+{
+    size = (offset < data->FileSize) ? ImMin(size, data->FileSize - offset) : 0;
+    if (offset < data->ReadBufOffset || offset + size > data->ReadBufOffset + data->ReadBufSize)
+    {
+        // Read a bit more than requested, so following lines are usually already available
+        const ImU64 read_size = (offset < data->FileSize) ? ImMin(ImMax(size, (ImU64)(64 * 1024)), data->FileSize - offset) : 0;
+        if ((ImU64)data->ReadBuf.Size < read_size)
+            data->ReadBuf.resize((int)read_size);
+        data->ReadBufOffset = offset;
+        data->ReadBufSize = FileViewerReadFile(data, offset, data->ReadBuf.Data, read_size);
+    }
+    *out_available = (offset < data->ReadBufOffset + data->ReadBufSize) ? data->ReadBufOffset + data->ReadBufSize - offset : 0;
+    return *out_available ? data->ReadBuf.Data + (offset - data->ReadBufOffset) : NULL;
+}
+
+// Return start offset of the line following 'offset'. Main thread only.
+static ImU64 FileViewerFindNextLine(ImGuiFileViewerData* data, ImU64 offset)
+{
+    while (offset < data->FileSize)
+    {
+        ImU64 available;
+        const char* p = FileViewerFetch(data, offset, 64 * 1024, &available);
+        if (available == 0)
+            break;
+        if (const char* eol = (const char*)memchr(p, '\n', (size_t)available))
+            return offset + (ImU64)(eol + 1 - p);
+        offset += available;
+    }
+    return data->FileSize;
+}
+
+//-------------------------------------------------------------------------
+// Indexing
+//-------------------------------------------------------------------------
+
+// Index line starts in [IndexedBytes, FileSize), publishing results every IMGUI_FILE_VIEWER_INDEX_CHUNK_SIZE bytes.
+// Stops early if the file was truncated meanwhile: the main thread will notice it and index the file again.
+static void FileViewerIndexThreadFunc(ImGuiFileViewerData* data)
+{
+    const ImU64 file_size = data->FileSize;
+    ImU64 pos;
+    {
+        std::lock_guard<std::mutex> lock(data->Mutex);
+        pos = data->IndexedBytes;
+    }
+    char* buf = (char*)malloc((size_t)ImMin((ImU64)IMGUI_FILE_VIEWER_INDEX_CHUNK_SIZE, file_size - pos));
+    std::vector<ImU64> new_offsets;
+    while (pos < file_size && !data->ThreadStop.load(std::memory_order_relaxed))
+    {
+        const ImU64 chunk_size = ImMin((ImU64)IMGUI_FILE_VIEWER_INDEX_CHUNK_SIZE, file_size - pos);
+        const ImU64 read_size = FileViewerReadFile(data, pos, buf, chunk_size);
+        if (read_size == 0)
+            break;
+        new_offsets.clear();
+        const char* p_end = buf + read_size;
+        for (const char* p = buf; (p = (const char*)memchr(p, '\n', (size_t)(p_end - p))) != NULL; )
+            new_offsets.push_back(pos + (ImU64)(++p - buf));
+        const ImU64 fingerprint_size = ImMin(read_size, (ImU64)IMGUI_FILE_VIEWER_FINGERPRINT_SIZE);
+        const ImGuiID fingerprint_hash = ImHashData(p_end - fingerprint_size, (size_t)fingerprint_size);
+
+        std::lock_guard<std::mutex> lock(data->Mutex);
+        data->AddLineOffsets(new_offsets.data(), (int)new_offsets.size());
+        data->IndexedBytes = pos = pos + read_size;
+        data->FingerprintOffset = pos - fingerprint_size;
+        data->FingerprintHash = fingerprint_hash;
+        if (read_size < chunk_size)
+            break;
+    }
+    free(buf);
+}
+
+static void FileViewerStopIndexing(ImGuiFileViewerData* data)
+{
+    if (!data->Thread.joinable())
+        return;
+    data->ThreadStop = true;
+    data->Thread.join();
+    data->ThreadStop = false;
+}
+
+static void FileViewerStartIndexing(ImGuiFileViewerData* data)
+{
+    IM_ASSERT(!data->Thread.joinable());
+    if (data->IndexedBytes < data->FileSize)
+        data->Thread = std::thread(FileViewerIndexThreadFunc, data);
+}
+
+static void FileViewerResetIndex(ImGuiFileViewerData* data)
+{
+    const ImU64 first_line_offset = 0;
+    data->LinesIndexed = 0; // Keep allocated blocks
+    data->AddLineOffsets(&first_line_offset, 1);
+    data->IndexedBytes = data->FingerprintOffset = 0;
+    data->FingerprintHash = 0;
+    data->ReadBufSize = 0;
+    data->MaxLineWidth = 0.0f;
+}
+
+// Return true if the last bytes hashed by the indexing thread are unchanged, i.e. the file wasn't truncated and written again.
+static bool FileViewerCheckFingerprint(ImGuiFileViewerData* data)
+{
+    ImU64 fingerprint_offset, fingerprint_size;
+    ImGuiID fingerprint_hash;
+    {
+        std::lock_guard<std::mutex> lock(data->Mutex);
+        fingerprint_offset = data->FingerprintOffset;
+        fingerprint_size = data->IndexedBytes - data->FingerprintOffset;
+        fingerprint_hash = data->FingerprintHash;
+    }
+    if (fingerprint_size == 0)
+        return true;
+    char buf[IMGUI_FILE_VIEWER_FINGERPRINT_SIZE];
+    return FileViewerReadFile(data, fingerprint_offset, buf, fingerprint_size) == fingerprint_size && ImHashData(buf, (size_t)fingerprint_size) == fingerprint_hash;
+}
+
+//-------------------------------------------------------------------------
+// ImGuiFileViewer
+//-------------------------------------------------------------------------
+
+ImGuiFileViewer::ImGuiFileViewer()
+{
+    Tail = true;
+    AutoScroll = true;
+    TailCheckInterval = 0.25f;
+    Data = NULL;
+}
+
+ImGuiFileViewer::~ImGuiFileViewer()
+{
+    Close();
+}
+
+bool ImGuiFileViewer::Open(const char* filename)
+{
+    Close();
+    Data = IM_NEW(ImGuiFileViewerData)();
+    if (!FileViewerOpenFile(Data, filename))
+    {
+        Close();
+        return false;
+    }
+    const int filename_len = (int)strlen(filename);
+    Data->Filename.resize(filename_len + 1);
+    memcpy(Data->Filename.Data, filename, (size_t)filename_len + 1);
+    Data->FileSize = FileViewerGetFileSize(Data);
+    FileViewerResetIndex(Data);
+    FileViewerStartIndexing(Data);
+    return true;
+}
+
+void ImGuiFileViewer::Close()
+{
+    if (Data == NULL)
+        return;
+    FileViewerStopIndexing(Data);
+    FileViewerCloseFile(Data);
+    IM_DELETE(Data);
+    Data = NULL;
+}
+
+bool ImGuiFileViewer::IsOpen() const
+{
+    return Data != NULL;
+}
+
+// Reload the file entirely if it was replaced, truncated, or truncated and written again (detected by checking the last indexed bytes).
+// Otherwise pick up appended data if 'check_appended' is set.
+// The file is never accessed beyond Data->FileSize, so a file truncated between two checks only yields short reads.
+static void FileViewerCheckFile(ImGuiFileViewer* viewer, bool check_appended)
+{
+    ImGuiFileViewerData* data = viewer->Data;
+    if (!FileViewerIsSameFile(data))
+    {
+        ImVector<char> filename;
+        filename.swap(data->Filename);
+        viewer->Open(filename.Data);
+        return;
+    }
+
+    const ImU64 new_size = FileViewerGetFileSize(data);
+    const bool rewritten = (new_size < data->FileSize) || !FileViewerCheckFingerprint(data);
+    if (!rewritten && (!check_appended || new_size == data->FileSize))
+        return;
+
+    // Indexing thread reads up to FileSize so it needs to be stopped first. Unless we start again from scratch, it will resume from where it stopped.
+    FileViewerStopIndexing(data);
+    if (rewritten)
+        FileViewerResetIndex(data);
+    data->FileSize = new_size;
+    FileViewerStartIndexing(data);
+}
+
+void ImGuiFileViewer::CheckForAppendedData()
+{
+    if (Data == NULL)
+        return;
+    FileViewerCheckFile(this, true);
+}
+
+float ImGuiFileViewer::GetIndexingProgress() const
+{
+    if (Data == NULL)
+        return 0.0f;
+    std::lock_guard<std::mutex> lock(Data->Mutex);
+    return Data->FileSize > 0 ? (float)((double)Data->IndexedBytes / (double)Data->FileSize) : 1.0f;
+}
+
+// Until indexing is complete, the number of lines in the remaining part is estimated from the average line length so far.
+// Must be called with Data->Mutex locked.
+static int FileViewerCalcLinesCount(ImGuiFileViewerData* data, bool* is_estimate)
+{
+    const ImU64 last_line_offset = data->GetLastLineOffset();
+    int lines_count = data->LinesIndexed;
+    if (data->IndexedBytes >= data->FileSize)
+    {
+        // Don't count the empty line after a trailing '\n'
+        if (last_line_offset == data->FileSize && lines_count > 1)
+            lines_count--;
+        *is_estimate = false;
+        return lines_count;
+    }
+    const ImU64 avg_line_length = (data->LinesIndexed > 1) ? ImMax(last_line_offset / (ImU64)(data->LinesIndexed - 1), (ImU64)1) : 80;
+    const ImU64 remaining_lines = (data->FileSize - last_line_offset) / avg_line_length;
+    *is_estimate = true;
+    return (int)ImMin((ImU64)lines_count + remaining_lines, (ImU64)INT_MAX);
+}
+
+int ImGuiFileViewer::GetLinesCount(bool* is_estimate) const
+{
+    bool dummy_is_estimate;
+    if (is_estimate == NULL)
+        is_estimate = &dummy_is_estimate;
+    *is_estimate = false;
+    if (Data == NULL)
+        return 0;
+    std::lock_guard<std::mutex> lock(Data->Mutex);
+    return FileViewerCalcLinesCount(Data, is_estimate);
+}
+
+// Return start offset of given line. Lines not indexed yet are located approximately, in which case *out_is_approx is set
+// and the caller needs to move to the start of the next line with FileViewerFindNextLine() (not done here as we don't want to read the file while holding the lock).
+// Must be called with Data->Mutex locked.
+static ImU64 FileViewerGetLineOffset(ImGuiFileViewerData* data, int line_no, bool* out_is_approx)
+{
+    *out_is_approx = false;
+    if (line_no < data->LinesIndexed)
+        return data->GetLineOffset(line_no);
+
+    const ImU64 last_line_offset = data->GetLastLineOffset();
+    const ImU64 avg_line_length = (data->LinesIndexed > 1) ? ImMax(last_line_offset / (ImU64)(data->LinesIndexed - 1), (ImU64)1) : 80;
+    const ImU64 approx_offset = last_line_offset + (ImU64)(line_no - (data->LinesIndexed - 1)) * avg_line_length;
+    if (approx_offset >= data->FileSize)
+        return data->FileSize;
+    *out_is_approx = true;
+    return approx_offset;
+}
+
+void ImGuiFileViewer::DrawContents()
+{
+    if (Data == NULL)
+        return;
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+
+    // Check for truncated or replaced file every frame, for appended data every TailCheckInterval
+    const bool check_appended = Tail && g.Time - Data->LastTailCheckTime >= TailCheckInterval;
+    if (check_appended)
+        Data->LastTailCheckTime = g.Time;
+    FileViewerCheckFile(this, check_appended);
+    if (Data == NULL)
+        return;
+
+    int lines_count;
+    {
+        std::lock_guard<std::mutex> lock(Data->Mutex);
+        bool is_estimate;
+        lines_count = FileViewerCalcLinesCount(Data, &is_estimate);
+    }
+    const bool scrolled_to_bottom = (ImGui::GetScrollY() >= ImGui::GetScrollMaxY());
+    const float start_x = window->DC.CursorPos.x;
+
+    // Display lines from a buffer holding the visible part of the file. We only need the offset of the first line of each visible range.
+    const ImU64 file_size = Data->FileSize;
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(g.Style.ItemSpacing.x, 0.0f));
+    ImGuiListClipper clipper;
+    clipper.Begin(lines_count, g.FontSize);
+    while (clipper.Step())
+    {
+        ImU64 offset;
+        bool offset_is_approx;
+        {
+            std::lock_guard<std::mutex> lock(Data->Mutex);
+            offset = FileViewerGetLineOffset(Data, clipper.DisplayStart, &offset_is_approx);
+        }
+        if (offset_is_approx)
+            offset = FileViewerFindNextLine(Data, offset);
+        for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd && offset < file_size; line_no++)
+        {
+            ImU64 available;
+            const char* line_begin = FileViewerFetch(Data, offset, IMGUI_FILE_VIEWER_MAX_LINE_LENGTH, &available);
+            if (available == 0)
+                break; // File was truncated since last check
+            const char* line_end = (const char*)memchr(line_begin, '\n', (size_t)available);
+            const ImU64 next_offset = line_end ? offset + (ImU64)(line_end + 1 - line_begin) : 0;
+            if (line_end == NULL)
+                line_end = line_begin + available; // Truncate long line, the rest of it is skipped below
+            if (line_end > line_begin && line_end[-1] == '\r')
+                line_end--;
+            ImGui::TextEx(line_begin, line_end, ImGuiTextFlags_NoWidthForLargeClippedText);
+            Data->MaxLineWidth = ImMax(Data->MaxLineWidth, g.LastItemData.Rect.GetWidth());
+            offset = next_offset ? next_offset : FileViewerFindNextLine(Data, offset + available);
+        }
+    }
+    clipper.End();
+    ImGui::PopStyleVar();
+
+    // Report width of widest line displayed so far, so horizontal scrolling doesn't change while scrolling vertically
+    window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, start_x + Data->MaxLineWidth);
+
+    if (AutoScroll && Tail && scrolled_to_bottom)
+        ImGui::SetScrollHereY(1.0f);
+}
+
+void ImGuiFileViewer::Draw(const char* title, bool* p_open)
+{
+    if (!ImGui::Begin(title, p_open))
+    {
+        ImGui::End();
+        return;
+    }
+    if (Data == NULL)
+    {
+        ImGui::TextDisabled("No file opened.");
+        ImGui::End();
+        return;
+    }
+
+    bool is_estimate;
+    const int lines_count = GetLinesCount(&is_estimate);
+    const float progress = GetIndexingProgress();
+    ImGui::Text("%s: %.1f MB, %s%d lines", Data->Filename.Data, (double)Data->FileSize / (1024.0 * 1024.0), is_estimate ? "~" : "", lines_count);
+    if (progress < 1.0f)
+    {
+        ImGui::SameLine();
+        ImGui::Text("(indexing %.0f%%)", progress * 100.0f);
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Tail", &Tail);
+    ImGui::SameLine();
+    ImGui::Checkbox("Auto-scroll", &AutoScroll);
+
+    ImGui::BeginChild("##lines", ImVec2(0.0f, 0.0f), true, ImGuiWindowFlags_HorizontalScrollbar);
+    DrawContents();
+    ImGui::EndChild();
+    ImGui::End();
+}
@@ -0,0 +1,68 @@
+// dear imgui: viewer for large text files (e.g. multi-GB logs)
+// (code using C++11 standard library threads, and POSIX or Win32 file I/O)
+
+// Changelog:
+// - v0.10: Initial version.
+
+// Usage:
+//   static ImGuiFileViewer viewer;
+//   if (!viewer.IsOpen())
+//       viewer.Open("my_log.txt");
+//   viewer.Draw("Log");                // Full window with status bar and options
+//   or, inside your own window/child:
+//   viewer.DrawContents();             // Only the lines, using ImGuiListClipper
+
+// Notes:
+// - The file is never loaded entirely. The indexing thread and the display read the parts they need with positional reads (pread() or ReadFile())
+//   into their own buffers, so the file may safely be truncated or rewritten while it is viewed (which isn't true of a memory-mapped file).
+// - Line start offsets are indexed in a background thread after Open(). Until the thread has reached a given part of the file,
+//   lines in that part are located approximately from the average line length so far, allowing to scroll anywhere immediately.
+//   Scrolling position may thus shift slightly while the index grows.
+// - Every frame, DrawContents() checks the file size and identity and the last indexed bytes. If the file shrinks (e.g. truncated by log rotation),
+//   is truncated and written again, or is replaced by another file of the same name, it is read and indexed again from the beginning.
+// - Tailing: when enabled, file size is checked every TailCheckInterval seconds. Appended data is indexed and displayed.
+// - Lines longer than IMGUI_FILE_VIEWER_MAX_LINE_LENGTH bytes are truncated on display.
+// - Content width is the width of the widest line displayed so far (measuring every line of a multi-GB file would be too slow).
+
+#pragma once
+
+#include "imgui.h"      // IMGUI_API
+
+#ifndef IMGUI_FILE_VIEWER_MAX_LINE_LENGTH
+#define IMGUI_FILE_VIEWER_MAX_LINE_LENGTH   4096                // Display limit per line, in bytes
+#endif
+#ifndef IMGUI_FILE_VIEWER_INDEX_CHUNK_SIZE
+#define IMGUI_FILE_VIEWER_INDEX_CHUNK_SIZE  (4 * 1024 * 1024)   // Indexing thread publishes new line offsets every N bytes
+#endif
+#ifndef IMGUI_FILE_VIEWER_FINGERPRINT_SIZE
+#define IMGUI_FILE_VIEWER_FINGERPRINT_SIZE  256                 // Number of last indexed bytes checked to detect a truncated and rewritten file
+#endif
+#ifndef IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE
+#define IMGUI_FILE_VIEWER_INDEX_BLOCK_SIZE  (64 * 1024)         // Number of line offsets per allocated block
+#endif
+
+struct ImGuiFileViewerData;
+
+struct ImGuiFileViewer
+{
+    // Options
+    bool                    Tail;                   // = true   // Check for data appended to the file
+    bool                    AutoScroll;             // = true   // Keep scrolling to the bottom when new data arrives and the view is already at the bottom
+    float                   TailCheckInterval;      // = 0.25f  // In seconds
+
+    // [Internal]
+    ImGuiFileViewerData*    Data;
+
+    IMGUI_API ImGuiFileViewer();
+    IMGUI_API ~ImGuiFileViewer();
+
+    IMGUI_API bool          Open(const char* filename);         // Return false if the file couldn't be opened
+    IMGUI_API void          Close();
+    IMGUI_API bool          IsOpen() const;
+    IMGUI_API void          CheckForAppendedData();             // Called by DrawContents() every TailCheckInterval when Tail is enabled. Also reloads a truncated or replaced file.
+    IMGUI_API float         GetIndexingProgress() const;        // 0.0f..1.0f
+    IMGUI_API int           GetLinesCount(bool* is_estimate = NULL) const;
+
+    IMGUI_API void          Draw(const char* title, bool* p_open = NULL);
+    IMGUI_API void          DrawContents();
+};
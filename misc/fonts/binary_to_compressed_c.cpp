@@ -7,6 +7,9 @@
 // (If we used 32-bit constants it would require take 11 bytes of source code to encode 4 bytes, and be endianness dependent)
 // Note that even with compression, the output array is likely to be bigger than the binary file..
 // Load compressed TTF fonts with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF()
+// With -lz the data is compressed with a byte-aligned LZ77 variant which is usually smaller and decodes several times faster than stb_compress() data.
+// With -u8 the output is an array of bytes instead of 32-bit constants, which is endianness independent (and combined with -nocompress,
+// can be passed directly to AddFontFromMemoryTTF() without any decompression at startup).
 
 // Build with, e.g:
 //   # cl.exe binary_to_compressed_c.cpp
@@ -15,10 +18,11 @@
 // You can also find a precompiled Windows binary in the binary/demo package available from https://github.com/ocornut/imgui
 
 // Usage:
-//   binary_to_compressed_c.exe [-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>
+//   binary_to_compressed_c.exe [-base85] [-u8] [-lz] [-nocompress] [-nostatic] <inputfile> <symbolname>
 // Usage example:
 //   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
 //   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -lz -u8 myfont.ttf MyFont > myfont.cpp
 
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
@@ -31,23 +35,30 @@ typedef unsigned int stb_uint;
 typedef unsigned char stb_uchar;
 stb_uint stb_compress(stb_uchar* out, stb_uchar* in, stb_uint len);
 
-static bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_static);
+// LZ compressor (format decoded by lz_decompress() in imgui_draw.cpp) - declaration
+static int lz_compress(unsigned char* out, const unsigned char* in, int len);
+
+static bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_u8_array, bool use_compression, bool use_lz, bool use_static);
 
 int main(int argc, char** argv)
 {
     if (argc < 3)
     {
-        printf("Syntax: %s [-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        printf("Syntax: %s [-base85] [-u8] [-lz] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
         return 0;
     }
 
     int argn = 1;
     bool use_base85_encoding = false;
+    bool use_u8_array = false;
     bool use_compression = true;
+    bool use_lz = false;
     bool use_static = true;
     while (argn < (argc - 2) && argv[argn][0] == '-')
     {
         if (strcmp(argv[argn], "-base85") == 0) { use_base85_encoding = true; argn++; }
+        else if (strcmp(argv[argn], "-u8") == 0) { use_u8_array = true; argn++; }
+        else if (strcmp(argv[argn], "-lz") == 0) { use_lz = true; argn++; }
         else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
         else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
         else
@@ -57,7 +68,7 @@ int main(int argc, char** argv)
         }
     }
 
-    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], use_base85_encoding, use_compression, use_static);
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], use_base85_encoding, use_u8_array, use_compression, use_lz, use_static);
     if (!ret)
         fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
     return ret ? 0 : 1;
@@ -69,7 +80,7 @@ char Encode85Byte(unsigned int x)
     return (char)((x >= '\\') ? x + 1 : x);
 }
 
-bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_static)
+bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_u8_array, bool use_compression, bool use_lz, bool use_static)
 {
     // Read file
     FILE* f = fopen(filename, "rb");
@@ -84,7 +95,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_b
     // Compress
     int maxlen = data_sz + 512 + (data_sz >> 2) + sizeof(int); // total guess
     char* compressed = use_compression ? new char[maxlen] : data;
-    int compressed_sz = use_compression ? stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz) : data_sz;
+    int compressed_sz = !use_compression ? data_sz : use_lz ? lz_compress((unsigned char*)compressed, (const unsigned char*)data, data_sz) : stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz);
     if (use_compression)
         memset(compressed + compressed_sz, 0, maxlen - compressed_sz);
 
@@ -113,6 +124,14 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_b
         }
         fprintf(out, "\";\n\n");
     }
+    else if (use_u8_array)
+    {
+        fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
+        fprintf(out, "%sconst unsigned char %s_%sdata[%d] =\n{", static_str, symbol, compressed_str, (int)compressed_sz);
+        for (int i = 0; i < compressed_sz; i++)
+            fprintf(out, (i % 24) == 0 ? "\n    %d," : "%d,", (unsigned char)compressed[i]);
+        fprintf(out, "\n};\n\n");
+    }
     else
     {
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
@@ -136,6 +155,109 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_b
     return true;
 }
 
+// LZ compressor - definition
+// Greedy parser with hash chains, emitting LZ4-style sequences:
+// token (4 bits literals count, 4 bits match length - 4), extra length bytes, literals, 2 bytes match offset.
+// Output starts with the "IMLZ" signature followed by the decompressed size (little-endian).
+
+#define LZ_MIN_MATCH        4
+#define LZ_MAX_OFFSET       65535
+#define LZ_HASH_BITS        16
+#define LZ_MAX_CHAIN        256
+#define LZ_LAST_LITERALS    5       // Always end with a few literals so the last sequence has no match
+
+static unsigned int lz_read32(const unsigned char* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24); }
+static unsigned int lz_hash(const unsigned char* p) { return (lz_read32(p) * 2654435761u) >> (32 - LZ_HASH_BITS); }
+
+static unsigned char* lz_write_length(unsigned char* op, int len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+static unsigned char* lz_write_sequence(unsigned char* op, const unsigned char* literals, int literals_len, int offset, int match_len)
+{
+    const int match_code = (match_len > 0) ? match_len - LZ_MIN_MATCH : 0;
+    *op++ = (unsigned char)(((literals_len < 15 ? literals_len : 15) << 4) | (match_code < 15 ? match_code : 15));
+    if (literals_len >= 15)
+        op = lz_write_length(op, literals_len - 15);
+    memcpy(op, literals, literals_len);
+    op += literals_len;
+    if (match_len > 0)
+    {
+        *op++ = (unsigned char)(offset & 0xFF);
+        *op++ = (unsigned char)(offset >> 8);
+        if (match_code >= 15)
+            op = lz_write_length(op, match_code - 15);
+    }
+    return op;
+}
+
+static int lz_compress(unsigned char* out, const unsigned char* in, int len)
+{
+    unsigned char* op = out;
+    *op++ = 'I'; *op++ = 'M'; *op++ = 'L'; *op++ = 'Z';
+    *op++ = (unsigned char)(len); *op++ = (unsigned char)(len >> 8); *op++ = (unsigned char)(len >> 16); *op++ = (unsigned char)(len >> 24);
+
+    int* head = new int[1 << LZ_HASH_BITS];
+    int* chain = new int[len > 0 ? len : 1];
+    for (int n = 0; n < (1 << LZ_HASH_BITS); n++)
+        head[n] = -1;
+
+    const int match_limit = len - LZ_LAST_LITERALS;
+    int anchor = 0;
+    int i = 0;
+    while (i + LZ_MIN_MATCH <= match_limit)
+    {
+        // Find longest match in hash chain
+        const unsigned int h = lz_hash(in + i);
+        int best_len = 0, best_offset = 0;
+        for (int candidate = head[h], tries = 0; candidate >= 0 && i - candidate <= LZ_MAX_OFFSET && tries < LZ_MAX_CHAIN; candidate = chain[candidate], tries++)
+        {
+            if (in[candidate + best_len] != in[i + best_len] || lz_read32(in + candidate) != lz_read32(in + i))
+                continue;
+            int match_len = LZ_MIN_MATCH;
+            while (i + match_len < match_limit && in[candidate + match_len] == in[i + match_len])
+                match_len++;
+            if (match_len > best_len)
+            {
+                best_len = match_len;
+                best_offset = i - candidate;
+            }
+        }
+        chain[i] = head[h];
+        head[h] = i;
+
+        if (best_len < LZ_MIN_MATCH)
+        {
+            i++;
+            continue;
+        }
+
+        op = lz_write_sequence(op, in + anchor, i - anchor, best_offset, best_len);
+
+        // Insert skipped positions into hash chains
+        for (int end = i + best_len, j = i + 1; j < end; j++)
+            if (j + LZ_MIN_MATCH <= len)
+            {
+                const unsigned int hj = lz_hash(in + j);
+                chain[j] = head[hj];
+                head[hj] = j;
+            }
+        i += best_len;
+        anchor = i;
+    }
+
+    // Last literals
+    op = lz_write_sequence(op, in + anchor, len - anchor, 0, 0);
+
+    delete[] head;
+    delete[] chain;
+    return (int)(op - out);
+}
+
 // stb_compress* from stb.h - definition
 
 ////////////////////           compressor         ///////////////////////
@@ -6,6 +6,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2022/08/24: added persistent cache of rendered glyphs, reused when rebuilding atlas. Added ImGuiFreeType::ClearGlyphCache().
+//              added optional multi-threaded glyph rendering with '#define IMGUI_ENABLE_FREETYPE_THREADS'.
 //  2021/08/23: fixed crash when FT_Render_Glyph() fails to render a glyph and returns NULL.
 //  2021/03/05: added ImGuiFreeTypeBuilderFlags_Bitmap to load bitmap glyphs.
 //  2021/03/02: set 'atlas->TexPixelsUseColors = true' to help some backends with deciding of a prefered texture format.
@@ -30,6 +32,21 @@
 // - For correct results you need to be using sRGB and convert to linear space in the pixel shader output.
 // - The default dear imgui styles will be impacted by this change (alpha values will need tweaking).
 
+// About Glyph Cache:
+// - Rendered glyphs are kept in a cache keyed by (font data, font number, size, builder flags, rasterizer multiply) + codepoint.
+//   Font data is identified by its size and a hash of its first and last bytes (the table directory at the start of a TrueType/OpenType
+//   file stores a checksum of every table), other parameters are compared exactly.
+// - The cache is shared by all atlases and protected by a mutex, so atlases may be built from different threads.
+// - Rebuilding an atlas (e.g. after adding a font, or changing the size of one font) only rasterizes glyphs which are not in the cache.
+// - Cached data of a font/size not used by the last IMGUI_FREETYPE_GLYPH_CACHE_MAX_AGE builds is discarded, then least recently used
+//   font/sizes are discarded until the cache is under IMGUI_FREETYPE_GLYPH_CACHE_MAX_SIZE bytes.
+//   Call ImGuiFreeType::ClearGlyphCache() to free all cached data (e.g. on shutdown, after destroying your atlases). Otherwise it is freed on exit.
+
+// About Multi-threaded Rendering:
+// - Add '#define IMGUI_ENABLE_FREETYPE_THREADS' in your imconfig.h file to render uncached glyphs on multiple threads (uses std::thread).
+// - Each thread uses its own FT_Library and FT_Face. Worker threads allocate with malloc()/free(), bypassing the dear imgui
+//   allocators and the ones set with SetAllocatorFunctions(), which are not required to be thread-safe.
+
 // FIXME: cfg.OversampleH, OversampleV are not supported (but perhaps not so necessary with this rasterizer).
 
 #include "imgui_freetype.h"
@@ -40,6 +57,31 @@
 #include FT_MODULE_H            // <freetype/ftmodapi.h>
 #include FT_GLYPH_H             // <freetype/ftglyph.h>
 #include FT_SYNTHESIS_H         // <freetype/ftsynth.h>
+#include <stdlib.h>             // malloc, realloc, free
+#include <mutex>
+#ifdef IMGUI_ENABLE_FREETYPE_THREADS
+#include <thread>
+#endif
+
+// Discard cached glyphs of a font/size not used by that many consecutive atlas builds
+#ifndef IMGUI_FREETYPE_GLYPH_CACHE_MAX_AGE
+#define IMGUI_FREETYPE_GLYPH_CACHE_MAX_AGE  8
+#endif
+
+// Discard least recently used cached glyphs once the cache uses more than that many bytes (glyphs are stored as RGBA32)
+#ifndef IMGUI_FREETYPE_GLYPH_CACHE_MAX_SIZE
+#define IMGUI_FREETYPE_GLYPH_CACHE_MAX_SIZE (32 * 1024 * 1024)
+#endif
+
+// Number of bytes at the start and at the end of font data hashed to identify it in the glyph cache
+#ifndef IMGUI_FREETYPE_GLYPH_CACHE_FINGERPRINT_SIZE
+#define IMGUI_FREETYPE_GLYPH_CACHE_FINGERPRINT_SIZE 4096
+#endif
+
+// Minimum number of glyphs to render per thread before spawning another thread
+#ifndef IMGUI_FREETYPE_THREADS_MIN_GLYPHS
+#define IMGUI_FREETYPE_THREADS_MIN_GLYPHS   256
+#endif
 
 #ifdef _MSC_VER
 #pragma warning (disable: 4505)     // unreferenced local function has been removed (stb stuff)
@@ -347,8 +389,140 @@ namespace
             IM_ASSERT(0 && "FreeTypeFont::BlitGlyph(): Unknown bitmap pixel mode!");
         }
     }
+
+    // A rendered glyph stored in the glyph cache.
+    struct CachedGlyph
+    {
+        GlyphInfo       Info;
+        int             PixelsOffset;       // Offset into CachedFace::Pixels[], -1 if the glyph couldn't be loaded or rendered.
+    };
+
+    // Rendered glyphs for one font at one size with one set of flags.
+    struct CachedFace
+    {
+        ImGuiID                 FontDataFingerprint;// Hash of first and last bytes of font data, see GetFontDataFingerprint()
+        int                     FontDataSize;
+        int                     FontNo;
+        unsigned int            UserFlags;
+        float                   SizePixels;
+        float                   RasterizerMultiply;
+        int                     LastUsedBuild;
+        ImGuiStorage            GlyphsMap;          // Codepoint -> Index into Glyphs[] + 1
+        ImVector<CachedGlyph>   Glyphs;
+        ImVector<unsigned int>  Pixels;             // RGBA32 pixels of all rendered glyphs
+
+        const CachedGlyph*      FindGlyph(uint32_t codepoint) const { int idx = GlyphsMap.GetInt((ImGuiID)codepoint, 0); return idx ? &Glyphs[idx - 1] : NULL; }
+        void                    AddGlyph(uint32_t codepoint, const GlyphInfo* info, const unsigned int* pixels);
+        size_t                  GetSizeInBytes() const { return sizeof(CachedFace) + (size_t)GlyphsMap.Data.size_in_bytes() + (size_t)Glyphs.size_in_bytes() + (size_t)Pixels.size_in_bytes(); }
+    };
+
+    struct GlyphCache
+    {
+        ImVector<CachedFace*>   Faces;
+        int                     BuildCount;         // Incremented on every atlas build, to detect unused faces.
+
+        GlyphCache()            { BuildCount = 0; }
+        ~GlyphCache()           { Clear(); }
+        CachedFace*             GetFace(const ImFontConfig& cfg, unsigned int user_flags);
+        void                    DiscardUnusedFaces();
+        void                    Clear();
+    };
+
+    // Identify font data without hashing all of it: TrueType/OpenType data starts with a table directory storing a checksum of
+    // every table (for collections, the directories of the fonts follow the header), so its first bytes and size identify its contents.
+    static ImGuiID GetFontDataFingerprint(const void* data, int data_size)
+    {
+        const int sample_size = ImMin(data_size, IMGUI_FREETYPE_GLYPH_CACHE_FINGERPRINT_SIZE);
+        ImGuiID hash = ImHashData(&data_size, sizeof(data_size), 0);
+        hash = ImHashData(data, (size_t)sample_size, hash);
+        hash = ImHashData((const unsigned char*)data + data_size - sample_size, (size_t)sample_size, hash);
+        return hash;
+    }
+
+    void CachedFace::AddGlyph(uint32_t codepoint, const GlyphInfo* info, const unsigned int* pixels)
+    {
+        CachedGlyph glyph;
+        memset(&glyph, 0, sizeof(glyph));
+        glyph.PixelsOffset = -1;
+        if (info != NULL)
+        {
+            glyph.Info = *info;
+            glyph.PixelsOffset = Pixels.Size;
+            const int pixels_count = info->Width * info->Height;
+            Pixels.resize(Pixels.Size + pixels_count);
+            if (pixels_count > 0)
+                memcpy(Pixels.Data + glyph.PixelsOffset, pixels, (size_t)pixels_count * sizeof(unsigned int));
+        }
+        Glyphs.push_back(glyph);
+        GlyphsMap.SetInt((ImGuiID)codepoint, Glyphs.Size); // Codepoints are added in increasing order so this is an append.
+    }
+
+    CachedFace* GlyphCache::GetFace(const ImFontConfig& cfg, unsigned int user_flags)
+    {
+        // Identify font data by its fingerprint, and compare all other parameters exactly.
+        const ImGuiID font_data_fingerprint = GetFontDataFingerprint(cfg.FontData, cfg.FontDataSize);
+        for (int n = 0; n < Faces.Size; n++)
+        {
+            CachedFace* face = Faces[n];
+            if (face->FontDataFingerprint == font_data_fingerprint && face->FontDataSize == cfg.FontDataSize && face->FontNo == cfg.FontNo && face->UserFlags == user_flags &&
+                face->SizePixels == cfg.SizePixels && face->RasterizerMultiply == cfg.RasterizerMultiply)
+            {
+                face->LastUsedBuild = BuildCount;
+                return face;
+            }
+        }
+        CachedFace* face = IM_NEW(CachedFace)();
+        face->FontDataFingerprint = font_data_fingerprint;
+        face->FontDataSize = cfg.FontDataSize;
+        face->FontNo = cfg.FontNo;
+        face->UserFlags = user_flags;
+        face->SizePixels = cfg.SizePixels;
+        face->RasterizerMultiply = cfg.RasterizerMultiply;
+        face->LastUsedBuild = BuildCount;
+        Faces.push_back(face);
+        return face;
+    }
+
+    void GlyphCache::DiscardUnusedFaces()
+    {
+        size_t total_size = 0;
+        for (int n = 0; n < Faces.Size; n++)
+        {
+            if (Faces[n]->LastUsedBuild < BuildCount - IMGUI_FREETYPE_GLYPH_CACHE_MAX_AGE)
+            {
+                IM_DELETE(Faces[n]);
+                Faces.erase(Faces.Data + n);
+                n--;
+                continue;
+            }
+            total_size += Faces[n]->GetSizeInBytes();
+        }
+
+        // Enforce size limit, discarding least recently used faces first
+        while (total_size > IMGUI_FREETYPE_GLYPH_CACHE_MAX_SIZE && Faces.Size > 0)
+        {
+            int oldest_n = 0;
+            for (int n = 1; n < Faces.Size; n++)
+                if (Faces[n]->LastUsedBuild < Faces[oldest_n]->LastUsedBuild)
+                    oldest_n = n;
+            total_size -= Faces[oldest_n]->GetSizeInBytes();
+            IM_DELETE(Faces[oldest_n]);
+            Faces.erase(Faces.Data + oldest_n);
+        }
+    }
+
+    void GlyphCache::Clear()
+    {
+        for (int n = 0; n < Faces.Size; n++)
+            IM_DELETE(Faces[n]);
+        Faces.clear();
+    }
 }
 
+// Persistent glyph cache, shared by all atlases. Freed by ImGuiFreeType::ClearGlyphCache(), or on exit.
+static GlyphCache GImGuiFreeTypeGlyphCache;
+static std::mutex GImGuiFreeTypeGlyphCacheMutex;
+
 #ifndef STB_RECT_PACK_IMPLEMENTATION                        // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION
 #define STBRP_ASSERT(x)     do { IM_ASSERT(x); } while (0)
@@ -366,7 +540,7 @@ struct ImFontBuildSrcGlyphFT
 {
     GlyphInfo           Info;
     uint32_t            Codepoint;
-    unsigned int*       BitmapData;         // Point within one of the dst_tmp_bitmap_buffers[] array
+    const unsigned int* BitmapData;         // Point within CachedFace::Pixels[] array
 
     ImFontBuildSrcGlyphFT() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -374,7 +548,10 @@ struct ImFontBuildSrcGlyphFT
 struct ImFontBuildSrcDataFT
 {
     FreeTypeFont        Font;
+    CachedFace*         CacheFace;          // Glyph cache for this font/size/flags
     stbrp_rect*         Rects;              // Rectangle to pack. We first fill in their size and the packer will give us their position.
+    bool                MultiplyEnabled;
+    unsigned char       MultiplyTable[256];
     const ImWchar*      SrcRanges;          // Ranges as requested by user (user is allowed to request too much, e.g. 0x0020..0xFFFF)
     int                 DstIndex;           // Index into atlas->Fonts[] and dst_tmp_array[]
     int                 GlyphsHighest;      // Highest requested codepoint
@@ -383,6 +560,37 @@ struct ImFontBuildSrcDataFT
     ImVector<ImFontBuildSrcGlyphFT>   GlyphsList;
 };
 
+// Output pixels (RGBA32) of a rendering thread.
+// Uses malloc()/free() rather than ImVector<> as it is grown on worker threads, where dear imgui allocators may not be used.
+struct ImFontBuildPixelsFT
+{
+    unsigned int*       Data;
+    int                 Size;
+    int                 Capacity;
+
+    ImFontBuildPixelsFT()   { Data = NULL; Size = Capacity = 0; }
+    ~ImFontBuildPixelsFT()  { free(Data); }
+    void                Grow(int count)
+    {
+        if (Size + count > Capacity)
+        {
+            Capacity = ImMax(Size + count, Capacity * 2);
+            Data = (unsigned int*)realloc(Data, (size_t)Capacity * sizeof(unsigned int));
+            IM_ASSERT(Data != NULL);
+        }
+        Size += count;
+    }
+};
+
+// A glyph missing from the glyph cache, to be rendered.
+struct ImFontBuildRenderJobFT
+{
+    int                 SrcIndex;           // Index into src_tmp_array[]
+    uint32_t            Codepoint;
+    GlyphInfo           Info;
+    int                 PixelsOffset;       // Offset into the rendering thread output pixels, -1 if the glyph couldn't be loaded or rendered.
+};
+
 // Temporary data for one destination ImFont* (multiple source fonts can be merged into one destination ImFont)
 struct ImFontBuildDstDataFT
 {
@@ -392,9 +600,73 @@ struct ImFontBuildDstDataFT
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+static bool ImGuiFreeTypeNewLibrary(FT_Library* out_library, FT_MemoryRec_* memory_rec, bool use_system_allocator);
+
+// Render a list of glyphs into 'out_pixels' (RGBA32). 'fonts[]' holds one font per source, which may be lazily initialized with InitFont().
+static void ImFontAtlasBuildRenderGlyphsFT(FreeTypeFont* fonts, const ImFontBuildSrcDataFT* src_tmp_array, ImFontBuildRenderJobFT* jobs, int jobs_count, ImFontBuildPixelsFT* out_pixels)
+{
+    for (int job_i = 0; job_i < jobs_count; job_i++)
+    {
+        ImFontBuildRenderJobFT& job = jobs[job_i];
+        const ImFontBuildSrcDataFT& src_tmp = src_tmp_array[job.SrcIndex];
+        FreeTypeFont& font = fonts[job.SrcIndex];
+        job.PixelsOffset = -1;
+
+        const FT_Glyph_Metrics* metrics = font.LoadGlyph(job.Codepoint);
+        if (metrics == NULL)
+            continue;
+
+        // Render glyph into a bitmap (currently held by FreeType)
+        const FT_Bitmap* ft_bitmap = font.RenderGlyphAndGetInfo(&job.Info);
+        if (ft_bitmap == NULL)
+            continue;
+
+        // Blit rasterized pixels to our output buffer
+        job.PixelsOffset = out_pixels->Size;
+        out_pixels->Grow(job.Info.Width * job.Info.Height);
+        font.BlitGlyph(ft_bitmap, (uint32_t*)out_pixels->Data + job.PixelsOffset, job.Info.Width, src_tmp.MultiplyEnabled ? (unsigned char*)src_tmp.MultiplyTable : NULL);
+    }
+}
+
+#ifdef IMGUI_ENABLE_FREETYPE_THREADS
+// Worker thread: use our own FT_Library and FT_Face instances as they cannot be shared between threads.
+// All allocations are made with malloc()/free(): dear imgui allocators (IM_ALLOC) and user allocators are not required to be thread-safe.
+static void ImFontAtlasBuildRenderGlyphsThreadFT(ImFontAtlas* atlas, unsigned int extra_flags, const ImFontBuildSrcDataFT* src_tmp_array, ImFontBuildRenderJobFT* jobs, int jobs_count, ImFontBuildPixelsFT* out_pixels)
+{
+    FT_MemoryRec_ memory_rec = {};
+    FT_Library ft_library;
+    if (!ImGuiFreeTypeNewLibrary(&ft_library, &memory_rec, true))
+    {
+        for (int job_i = 0; job_i < jobs_count; job_i++)
+            jobs[job_i].PixelsOffset = -1;
+        return;
+    }
+
+    // Initialize only the fonts we need
+    const int fonts_count = atlas->ConfigData.Size;
+    FreeTypeFont* fonts = (FreeTypeFont*)malloc(sizeof(FreeTypeFont) * (size_t)fonts_count);
+    IM_ASSERT(fonts != NULL);
+    memset((void*)fonts, 0, sizeof(FreeTypeFont) * (size_t)fonts_count);
+    for (int job_i = 0; job_i < jobs_count; job_i++)
+    {
+        const int src_i = jobs[job_i].SrcIndex;
+        if (fonts[src_i].Face == NULL && !fonts[src_i].InitFont(ft_library, atlas->ConfigData[src_i], extra_flags))
+            fonts[src_i].CloseFont(); // Glyphs will fail to load
+    }
+
+    ImFontAtlasBuildRenderGlyphsFT(fonts, src_tmp_array, jobs, jobs_count, out_pixels);
+
+    for (int src_i = 0; src_i < fonts_count; src_i++)
+        fonts[src_i].CloseFont();
+    free(fonts);
+    FT_Done_Library(ft_library);
+}
+#endif
+
 bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, unsigned int extra_flags)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
+    IM_ASSERT(!(atlas->Flags & ImFontAtlasFlags_SignedDistanceField) && "ImFontAtlasFlags_SignedDistanceField is not supported by the FreeType builder yet!");
 
     ImFontAtlasBuildInit(atlas);
 
@@ -505,19 +777,15 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     buf_rects.resize(total_glyphs_count);
     memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
 
-    // Allocate temporary rasterization data buffers.
-    // We could not find a way to retrieve accurate glyph size without rendering them.
-    // (e.g. slot->metrics->width not always matching bitmap->width, especially considering the Oblique transform)
-    // We allocate in chunks of 256 KB to not waste too much extra memory ahead. Hopefully users of FreeType won't find the temporary allocations.
-    const int BITMAP_BUFFERS_CHUNK_SIZE = 256 * 1024;
-    int buf_bitmap_current_used_bytes = 0;
-    ImVector<unsigned char*> buf_bitmap_buffers;
-    buf_bitmap_buffers.push_back((unsigned char*)IM_ALLOC(BITMAP_BUFFERS_CHUNK_SIZE));
-
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
-    // 8. Render/rasterize font characters into the texture
-    int total_surface = 0;
-    int buf_rects_out_n = 0;
+    // Glyphs are looked up in the persistent glyph cache. We could not find a way to retrieve accurate glyph size without rendering them.
+    // (e.g. slot->metrics->width not always matching bitmap->width, especially considering the Oblique transform)
+    // So glyphs missing from the cache are rendered and added to the cache first.
+    // The cache lock is held until the end of the build, as we keep pointers to cached faces and pixels.
+    std::lock_guard<std::mutex> cache_lock(GImGuiFreeTypeGlyphCacheMutex);
+    GlyphCache& cache = GImGuiFreeTypeGlyphCache;
+    cache.BuildCount++;
+    ImVector<ImFontBuildRenderJobFT> render_jobs;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
@@ -525,85 +793,102 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        src_tmp.Rects = &buf_rects[buf_rects_out_n];
-        buf_rects_out_n += src_tmp.GlyphsCount;
-
         // Compute multiply table if requested
-        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
-        unsigned char multiply_table[256];
-        if (multiply_enabled)
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        src_tmp.MultiplyEnabled = (cfg.RasterizerMultiply != 1.0f);
+        if (src_tmp.MultiplyEnabled)
+            ImFontAtlasBuildMultiplyCalcLookupTable(src_tmp.MultiplyTable, cfg.RasterizerMultiply);
 
-        // Gather the sizes of all rectangles we will need to pack
-        const int padding = atlas->TexGlyphPadding;
+        src_tmp.CacheFace = cache.GetFace(cfg, src_tmp.Font.UserFlags);
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
-        {
-            ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
-
-            const FT_Glyph_Metrics* metrics = src_tmp.Font.LoadGlyph(src_glyph.Codepoint);
-            if (metrics == NULL)
-                continue;
-
-            // Render glyph into a bitmap (currently held by FreeType)
-            const FT_Bitmap* ft_bitmap = src_tmp.Font.RenderGlyphAndGetInfo(&src_glyph.Info);
-            if (ft_bitmap == NULL)
-                continue;
-
-            // Allocate new temporary chunk if needed
-            const int bitmap_size_in_bytes = src_glyph.Info.Width * src_glyph.Info.Height * 4;
-            if (buf_bitmap_current_used_bytes + bitmap_size_in_bytes > BITMAP_BUFFERS_CHUNK_SIZE)
+            if (src_tmp.CacheFace->FindGlyph(src_tmp.GlyphsList[glyph_i].Codepoint) == NULL)
             {
-                buf_bitmap_current_used_bytes = 0;
-                buf_bitmap_buffers.push_back((unsigned char*)IM_ALLOC(BITMAP_BUFFERS_CHUNK_SIZE));
+                ImFontBuildRenderJobFT job;
+                memset(&job, 0, sizeof(job));
+                job.SrcIndex = src_i;
+                job.Codepoint = src_tmp.GlyphsList[glyph_i].Codepoint;
+                render_jobs.push_back(job);
             }
+    }
 
-            // Blit rasterized pixels to our temporary buffer and keep a pointer to it.
-            src_glyph.BitmapData = (unsigned int*)(buf_bitmap_buffers.back() + buf_bitmap_current_used_bytes);
-            buf_bitmap_current_used_bytes += bitmap_size_in_bytes;
-            src_tmp.Font.BlitGlyph(ft_bitmap, src_glyph.BitmapData, src_glyph.Info.Width, multiply_enabled ? multiply_table : NULL);
+    // Render missing glyphs, on multiple threads if enabled and worth it. The calling thread renders the first batch using the already opened fonts.
+    if (render_jobs.Size > 0)
+    {
+        ImVector<FreeTypeFont> src_fonts; // Shallow copies of src_tmp_array[].Font, not owning their FT_Face.
+        src_fonts.resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+            memcpy((void*)&src_fonts[src_i], (const void*)&src_tmp_array[src_i].Font, sizeof(FreeTypeFont));
+
+        int threads_count = 1;
+#ifdef IMGUI_ENABLE_FREETYPE_THREADS
+        threads_count = ImClamp((int)std::thread::hardware_concurrency(), 1, 16);
+        threads_count = ImClamp(render_jobs.Size / IMGUI_FREETYPE_THREADS_MIN_GLYPHS, 1, threads_count);
+#endif
+        ImVector<ImFontBuildPixelsFT> threads_pixels;
+        threads_pixels.resize(threads_count, ImFontBuildPixelsFT());
+        const int jobs_per_thread = (render_jobs.Size + threads_count - 1) / threads_count;
+#ifdef IMGUI_ENABLE_FREETYPE_THREADS
+        ImVector<std::thread*> threads;
+        for (int thread_i = 1; thread_i < threads_count; thread_i++)
+        {
+            const int job_start = thread_i * jobs_per_thread;
+            const int job_count = ImMin(jobs_per_thread, render_jobs.Size - job_start);
+            threads.push_back(IM_NEW(std::thread)(ImFontAtlasBuildRenderGlyphsThreadFT, atlas, extra_flags, src_tmp_array.Data, render_jobs.Data + job_start, job_count, &threads_pixels[thread_i]));
+        }
+#endif
+        ImFontAtlasBuildRenderGlyphsFT(src_fonts.Data, src_tmp_array.Data, render_jobs.Data, ImMin(jobs_per_thread, render_jobs.Size), &threads_pixels[0]);
+#ifdef IMGUI_ENABLE_FREETYPE_THREADS
+        for (int thread_i = 0; thread_i < threads.Size; thread_i++)
+        {
+            threads[thread_i]->join();
+            IM_DELETE(threads[thread_i]);
+        }
+#endif
+        src_fonts.clear(); // Not calling destructors, as FT_Face are owned by src_tmp_array[]
 
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(src_glyph.Info.Width + padding);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(src_glyph.Info.Height + padding);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+        // Store in cache (in order, so codepoints are added in increasing order for each face)
+        for (int job_i = 0; job_i < render_jobs.Size; job_i++)
+        {
+            const ImFontBuildRenderJobFT& job = render_jobs[job_i];
+            const ImFontBuildPixelsFT& pixels = threads_pixels[job_i / jobs_per_thread];
+            CachedFace* face = src_tmp_array[job.SrcIndex].CacheFace;
+            face->AddGlyph(job.Codepoint, (job.PixelsOffset != -1) ? &job.Info : NULL, (job.PixelsOffset != -1) ? pixels.Data + job.PixelsOffset : NULL);
         }
+        threads_pixels.clear_destruct();
     }
 
-    // We need a width for the skyline algorithm, any width!
-    // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
-    // User can override TexDesiredWidth and TexGlyphPadding if they wish, otherwise we use a simple heuristic to select the width based on expected surface.
-    const int surface_sqrt = (int)ImSqrt((float)total_surface) + 1;
-    atlas->TexHeight = 0;
-    if (atlas->TexDesiredWidth > 0)
-        atlas->TexWidth = atlas->TexDesiredWidth;
-    else
-        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
-
-    // 5. Start packing
-    // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
-    const int TEX_HEIGHT_MAX = 1024 * 32;
-    const int num_nodes_for_packing_algorithm = atlas->TexWidth - atlas->TexGlyphPadding;
-    ImVector<stbrp_node> pack_nodes;
-    pack_nodes.resize(num_nodes_for_packing_algorithm);
-    stbrp_context pack_context;
-    stbrp_init_target(&pack_context, atlas->TexWidth, TEX_HEIGHT_MAX, pack_nodes.Data, pack_nodes.Size);
-    ImFontAtlasBuildPackCustomRects(atlas, &pack_context);
-
-    // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+    // Gather the sizes of all rectangles we will need to pack
+    int total_surface = 0;
+    int buf_rects_out_n = 0;
+    const int padding = atlas->TexGlyphPadding;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects(&pack_context, src_tmp.Rects, src_tmp.GlyphsCount);
+        src_tmp.Rects = &buf_rects[buf_rects_out_n];
+        buf_rects_out_n += src_tmp.GlyphsCount;
 
-        // Extend texture height and mark missing glyphs as non-packed so we won't render them.
-        // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
-            if (src_tmp.Rects[glyph_i].was_packed)
-                atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+        {
+            ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
+            const CachedGlyph* cached_glyph = src_tmp.CacheFace->FindGlyph(src_glyph.Codepoint);
+            IM_ASSERT(cached_glyph != NULL);
+            if (cached_glyph->PixelsOffset == -1)
+                continue;
+
+            src_glyph.Info = cached_glyph->Info;
+            src_glyph.BitmapData = src_tmp.CacheFace->Pixels.Data + cached_glyph->PixelsOffset;
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(src_glyph.Info.Width + padding);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(src_glyph.Info.Height + padding);
+            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+        }
     }
 
+    // 5. Select texture width and pack custom rectangles + all glyphs rectangles.
+    // No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+    ImFontAtlasBuildPackGlyphRects(atlas, buf_rects.Data, buf_rects.Size, total_surface);
+
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
@@ -641,7 +926,6 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         const float font_off_x = cfg.GlyphOffset.x;
         const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
 
-        const int padding = atlas->TexGlyphPadding;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
             ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
@@ -675,7 +959,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
             // Blit from temporary buffer to final texture
             size_t blit_src_stride = (size_t)src_glyph.Info.Width;
             size_t blit_dst_stride = (size_t)atlas->TexWidth;
-            unsigned int* blit_src = src_glyph.BitmapData;
+            const unsigned int* blit_src = src_glyph.BitmapData;
             if (atlas->TexPixelsAlpha8 != NULL)
             {
                 unsigned char* blit_dst = atlas->TexPixelsAlpha8 + (ty * blit_dst_stride) + tx;
@@ -697,9 +981,8 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     atlas->TexPixelsUseColors = tex_use_colors;
 
     // Cleanup
-    for (int buf_i = 0; buf_i < buf_bitmap_buffers.Size; buf_i++)
-        IM_FREE(buf_bitmap_buffers[buf_i]);
     src_tmp_array.clear_destruct();
+    cache.DiscardUnusedFaces();
 
     ImFontAtlasBuildFinish(atlas);
 
@@ -740,23 +1023,47 @@ static void* FreeType_Realloc(FT_Memory /*memory*/, long cur_size, long new_size
     return block;
 }
 
-static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
+// FreeType memory allocation callbacks for worker threads, bypassing user allocators which may not be thread-safe
+static void* FreeType_SystemAlloc(FT_Memory /*memory*/, long size)
+{
+    return malloc((size_t)size);
+}
+
+static void FreeType_SystemFree(FT_Memory /*memory*/, void* block)
+{
+    free(block);
+}
+
+static void* FreeType_SystemRealloc(FT_Memory /*memory*/, long /*cur_size*/, long new_size, void* block)
+{
+    return realloc(block, (size_t)new_size);
+}
+
+// 'memory_rec' needs to stay valid for the lifetime of the library.
+static bool ImGuiFreeTypeNewLibrary(FT_Library* out_library, FT_MemoryRec_* memory_rec, bool use_system_allocator)
 {
     // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
-    FT_MemoryRec_ memory_rec = {};
-    memory_rec.user = NULL;
-    memory_rec.alloc = &FreeType_Alloc;
-    memory_rec.free = &FreeType_Free;
-    memory_rec.realloc = &FreeType_Realloc;
+    memory_rec->user = NULL;
+    memory_rec->alloc = use_system_allocator ? &FreeType_SystemAlloc : &FreeType_Alloc;
+    memory_rec->free = use_system_allocator ? &FreeType_SystemFree : &FreeType_Free;
+    memory_rec->realloc = use_system_allocator ? &FreeType_SystemRealloc : &FreeType_Realloc;
 
     // https://www.freetype.org/freetype2/docs/reference/ft2-module_management.html#FT_New_Library
-    FT_Library ft_library;
-    FT_Error error = FT_New_Library(&memory_rec, &ft_library);
+    FT_Error error = FT_New_Library(memory_rec, out_library);
     if (error != 0)
         return false;
 
     // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
-    FT_Add_Default_Modules(ft_library);
+    FT_Add_Default_Modules(*out_library);
+    return true;
+}
+
+static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
+{
+    FT_MemoryRec_ memory_rec = {};
+    FT_Library ft_library;
+    if (!ImGuiFreeTypeNewLibrary(&ft_library, &memory_rec, false))
+        return false;
 
     bool ret = ImFontAtlasBuildWithFreeTypeEx(ft_library, atlas, atlas->FontBuilderFlags);
     FT_Done_Library(ft_library);
@@ -771,6 +1078,12 @@ const ImFontBuilderIO* ImGuiFreeType::GetBuilderForFreeType()
     return &io;
 }
 
+void ImGuiFreeType::ClearGlyphCache()
+{
+    std::lock_guard<std::mutex> cache_lock(GImGuiFreeTypeGlyphCacheMutex);
+    GImGuiFreeTypeGlyphCache.Clear();
+}
+
 void ImGuiFreeType::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data)
 {
     GImGuiFreeTypeAllocFunc = alloc_func;
@@ -42,6 +42,11 @@ namespace ImGuiFreeType
     // However, as FreeType does lots of allocations we provide a way for the user to redirect it to a separate memory heap if desired.
     IMGUI_API void                      SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
 
+    // Rendered glyphs are cached and reused when rebuilding font atlases. Glyphs of a font/size unused for a few builds are automatically discarded,
+    // and the cache size is bounded by IMGUI_FREETYPE_GLYPH_CACHE_MAX_SIZE. The cache is freed on exit.
+    // Call this to free all cached glyphs earlier (e.g. on shutdown after destroying your context and atlases, or before calling ImGui::SetAllocatorFunctions()).
+    IMGUI_API void                      ClearGlyphCache();
+
     // Obsolete names (will be removed soon)
     // Prefer using '#define IMGUI_ENABLE_FREETYPE'
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS